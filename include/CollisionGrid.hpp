@@ -0,0 +1,129 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "enemies/EnemyPool.hpp"
+
+enum class ColliderKind : uint8_t {
+    PLAYER,
+    ENEMY
+};
+
+namespace ColliderMask {
+    constexpr uint32_t PLAYER = 1u << static_cast<uint32_t>(ColliderKind::PLAYER);
+    constexpr uint32_t ENEMY = 1u << static_cast<uint32_t>(ColliderKind::ENEMY);
+    constexpr uint32_t ALL = PLAYER | ENEMY;
+}
+
+using ColliderId = uint32_t;
+
+// Whether the segment from -> to touches box; tEnter receives where it
+// enters, as a fraction of the segment (0 when it starts inside).
+bool SegmentEntersRect(Vector2 from, Vector2 to, const Rectangle& box, float& tEnter);
+
+struct Collider {
+    Rectangle bounds;  // fattened by CollisionGrid::MARGIN
+    ColliderKind kind;
+    EnemyHandle enemy;  // ENEMY only
+};
+
+// Broadphase for gameplay collisions: a uniform grid of CELL_SIZE cells,
+// hashed into BUCKET_COUNT buckets so its size doesn't depend on the map.
+// Rebuilt once per tick (clear, add, build) with a counting sort, so a
+// query only looks at the entries of the cells it covers and its cost
+// follows local density rather than the number of entities.
+//
+// Bounds are grown by MARGIN when added. Queries made before the next
+// rebuild (the player's attacks, early in the tick) then still find
+// anything that has moved less than MARGIN, and hitboxes that differ a
+// little from the stored one are covered too. Results are candidates:
+// callers keep their exact hitbox test and must resolve handles, which
+// go stale if the enemy has been removed.
+//
+// Each overlap is reported once, from the cell holding the corner where
+// the two boxes start to overlap. Queries are const and may run in parallel.
+class CollisionGrid {
+public:
+    static constexpr float CELL_SIZE = 64.0f;
+    static constexpr size_t BUCKET_COUNT = 4096;
+    static constexpr float MARGIN = 32.0f;
+
+    static CollisionGrid& getInstance();
+
+    void clear();
+    ColliderId add(Rectangle bounds, ColliderKind kind, EnemyHandle enemy = {});
+    void build();
+
+    size_t size() const { return colliders.size(); }
+    const Collider& get(ColliderId id) const { return colliders[id]; }
+
+    // Append the ids whose bounds touch the shape and whose kind is in mask.
+    void queryRect(Rectangle area, uint32_t mask, std::vector<ColliderId>& out) const;
+    void queryCircle(Vector2 center, float radius, uint32_t mask, std::vector<ColliderId>& out) const;
+    // Ordered by where the segment enters each box, nearest first.
+    void querySegment(Vector2 from, Vector2 to, uint32_t mask, std::vector<ColliderId>& out) const;
+
+    // Calls fn(a, b) once for every overlapping pair with a in maskA and b
+    // in maskB.
+    template <typename Fn>
+    void forEachPair(uint32_t maskA, uint32_t maskB, Fn&& fn) const {
+        for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            uint32_t first = bucketStart[bucket];
+            uint32_t last = bucketStart[bucket + 1];
+            for (uint32_t i = first; i < last; ++i) {
+                const Entry& a = entries[i];
+                if (!((a.kindBit & maskA) || (a.kindBit & maskB))) continue;
+                for (uint32_t j = i + 1; j < last; ++j) {
+                    const Entry& b = entries[j];
+                    if (b.cellX != a.cellX || b.cellY != a.cellY) continue;
+                    bool forward = (a.kindBit & maskA) && (b.kindBit & maskB);
+                    bool backward = (b.kindBit & maskA) && (a.kindBit & maskB);
+                    if (!forward && !backward) continue;
+                    const Rectangle& boxA = colliders[a.collider].bounds;
+                    const Rectangle& boxB = colliders[b.collider].bounds;
+                    if (!overlaps(boxA, boxB) || !isReferenceCell(boxA, boxB, a.cellX, a.cellY)) continue;
+                    if (forward) {
+                        fn(a.collider, b.collider);
+                    } else {
+                        fn(b.collider, a.collider);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        int32_t cellX;
+        int32_t cellY;
+        ColliderId collider;
+        uint32_t kindBit;
+    };
+
+    CollisionGrid();
+    CollisionGrid(const CollisionGrid&) = delete;
+    CollisionGrid& operator=(const CollisionGrid&) = delete;
+
+    static int cellOf(float world);
+    static size_t bucketOf(int cellX, int cellY);
+    static bool overlaps(const Rectangle& a, const Rectangle& b);
+    static bool isReferenceCell(const Rectangle& a, const Rectangle& b, int cellX, int cellY);
+
+    template <typename Fn>
+    void forEachEntryInCell(int cellX, int cellY, uint32_t mask, Fn&& fn) const {
+        size_t bucket = bucketOf(cellX, cellY);
+        for (uint32_t i = bucketStart[bucket]; i < bucketStart[bucket + 1]; ++i) {
+            const Entry& entry = entries[i];
+            if (entry.cellX == cellX && entry.cellY == cellY && (entry.kindBit & mask)) {
+                fn(entry.collider);
+            }
+        }
+    }
+
+    std::vector<Collider> colliders;
+    std::vector<Entry> pending;            // one per covered cell, in add order
+    std::vector<Entry> entries;            // pending sorted by bucket
+    std::vector<uint32_t> bucketStart;     // BUCKET_COUNT + 1 offsets into entries
+    std::vector<uint32_t> cursor;          // build() scatter positions
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "enemies/EnemyPool.hpp"
+
+class Player;
+class GameCamera;
+class EnemyManager;
+
+// In the order the stages that emit them run, which is also the order
+// hits on one target are tried in.
+enum class HitSource : uint8_t {
+    WEAPON,      // sourceId is the weapon's swing
+    EXPLOSION,
+    PROJECTILE,
+    CONTACT
+};
+
+struct HitCandidate {
+    HitSource source = HitSource::CONTACT;
+    EnemyHandle target;              // invalid: the player
+    uint32_t sourceId = 0;
+    int damage = 0;
+    Vector2 knockback = { 0, 0 };    // applied when non-zero
+    float shakeIntensity = 0.0f;     // camera shake when it lands
+    float shakeDuration = 0.0f;
+    Vector2 impact = { 0, 0 };       // where particleCount particles burst
+    int particleCount = 0;
+    Color particleColor = WHITE;
+};
+
+struct CombatStats {
+    uint64_t submitted = 0;
+    uint64_t landed = 0;
+    uint64_t blocked = 0;     // invincible, already hit this tick or this swing
+    uint64_t defeated = 0;
+};
+
+// Every hit in a tick goes through here. Stages that find overlaps only
+// read the player and the enemies and submit candidates; resolve() runs
+// once, after all of them, and is the only place damage is applied.
+//
+// Candidates are sorted by target and then by source, keeping emission
+// order within a source, so the outcome doesn't depend on which stage or
+// worker found a hit first. Each target takes at most one hit per tick,
+// since any hit opens its invincibility window, and an enemy takes at
+// most one hit from a weapon swing however long the swing lasts. Health
+// and defeat events are queued together once everything has landed.
+class CombatResolver {
+public:
+    static CombatResolver& getInstance();
+
+    void submit(const HitCandidate& hit);
+    void resolve(EnemyManager& enemyManager, Player& player, GameCamera& camera);
+    void clear();
+
+    size_t getPendingCount() const { return candidates.size(); }
+    const CombatStats& getStats() const { return stats; }
+    void dumpStats() const;
+
+private:
+    CombatResolver() = default;
+    CombatResolver(const CombatResolver&) = delete;
+    CombatResolver& operator=(const CombatResolver&) = delete;
+
+    std::vector<HitCandidate> candidates;
+    uint32_t currentSwing = 0;
+    std::vector<EnemyHandle> swingVictims;  // enemies currentSwing has hit
+    CombatStats stats;
+};
@@ -0,0 +1,70 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Map;
+
+// Distance-to-player over walkable cells (same rule and 4-connectivity as
+// FindPathAStar) inside a square window around the player. Every chaser in
+// the window reads its next step from the field in O(1), so chasing costs
+// one breadth-first fill however many enemies are on screen.
+//
+// Fills run incrementally: a rebuild starts when the player changes cell (or
+// every REFRESH_TICKS to pick up tile changes), expands at most
+// EXPANSION_BUDGET cells per tick into a back buffer, and is swapped in
+// once complete. Readers keep using the previous field until then.
+class FlowField {
+public:
+    static constexpr int RADIUS = 40;
+    static constexpr int REBUILD_INTERVAL = 4;
+    static constexpr int REFRESH_TICKS = 60;
+    static constexpr int EXPANSION_BUDGET = 4096;
+
+    static FlowField& getInstance();
+
+    // Drops both fields. Call whenever the map is swapped or freed.
+    void setMap(const Map* newMap);
+
+    // Once per tick, after the player has moved.
+    void update(Vector2 target);
+
+    // World position of the next tile toward the target, in FindPathAStar's
+    // output convention. At the target the step is the current tile. False
+    // when the position is outside the field or cannot reach the target.
+    bool nextStep(Vector2 position, Vector2& outStep) const;
+    // Steps to the target, or -1 if unknown.
+    int distanceAt(Vector2 position) const;
+
+private:
+    static constexpr int SIDE = RADIUS * 2 + 1;
+    static constexpr uint16_t UNREACHED = UINT16_MAX;
+
+    struct Field {
+        int originX = 0;   // tile coordinates of the window's corner
+        int originY = 0;
+        int targetX = -1;
+        int targetY = -1;
+        bool valid = false;
+        std::vector<uint16_t> distance;  // SIDE * SIDE, column-major like the map
+
+        int at(int x, int y) const;
+    };
+
+    FlowField();
+    FlowField(const FlowField&) = delete;
+    FlowField& operator=(const FlowField&) = delete;
+
+    void beginRebuild(int targetX, int targetY);
+    // Returns true once the fill has finished.
+    bool expand(int budget);
+
+    const Map* map = nullptr;
+    Field front;
+    Field back;
+    std::vector<int32_t> frontier;  // window-local indices, consumed from frontierHead
+    size_t frontierHead = 0;
+    bool rebuilding = false;
+    int ticksSinceRebuild = 0;
+};
@@ -7,10 +7,12 @@
 #include "ui/UIController.hpp"
 #include "core/GameLoop.hpp"
 #include "core/ResourceManager.hpp"
+#include "core/ResourcePreloadJob.hpp"
+#include "MapGenerationJob.hpp"
+#include "core/TaskGraph.hpp"
 #include <memory>
 #include <raylib.h>
 #include <vector>
-#include <future>
 #include <atomic>
 
 enum class GameState {
@@ -49,8 +51,7 @@ private:
     EnemyManager enemyManager;
     Spawner spawner;
     GameState currentState;
-    std::vector<Texture2D> tileTextures;
-    std::vector<Core::ResourceHandle<Texture2D>> tileTextureHandles;
+    std::shared_ptr<Core::ResourcePreloadJob> tilePreloadJob;
     Core::ResourceHandle<Shader> bloomShaderHandle;
     Core::ResourceHandle<Shader> chromaticAberrationShaderHandle;
     Core::ResourceHandle<Shader> screenshakeShaderHandle;
@@ -65,21 +66,20 @@ private:
     float pauseDebounceTimer;
     
 
-    std::future<void> mapGenerationFuture;
-    std::atomic<bool> mapGenerationInProgress{false};
-    std::atomic<bool> mapGenerationComplete{false};
+    std::shared_ptr<MapGenerationJob> mapGenerationJob;
     float loadingStartTime;
     const float loadingTimeoutSeconds = 30.0f;
 
-    std::unique_ptr<Map> tempMap;
-    std::unique_ptr<Player> tempPlayer;
-    std::unique_ptr<GameCamera> tempCamera;
-    EnemyManager tempEnemyManager;
+    TaskGraph simulationGraph;
+    float tickDeltaTime = 0.0f;
     
     void update(float deltaTime);
+    void buildSimulationGraph();
     void render(float interpolation);
     void handleInput();
     void initializeResources();
+    void cancelMapGeneration();
+    void finishMapGeneration();
     
 
 };
\ No newline at end of file
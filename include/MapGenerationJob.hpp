@@ -0,0 +1,40 @@
+#pragma once
+#include "core/LongJob.hpp"
+#include "core/ResourcePreloadJob.hpp"
+#include "map/Map.hpp"
+#include "Player.hpp"
+#include "Camera.hpp"
+#include "enemies/EnemyManager.hpp"
+#include <memory>
+
+class Spawner;
+
+// Builds a new run off the main thread: waits for the tile preload, then
+// map, player, camera and enemies, one state per slice. The results are
+// only touched by the main thread once the job reports DONE.
+class MapGenerationJob : public LongJob {
+public:
+    MapGenerationJob(std::shared_ptr<Core::ResourcePreloadJob> tilePreload, Spawner& spawner,
+                     int screenWidth, int screenHeight);
+
+    std::unique_ptr<Map> map;
+    std::unique_ptr<Player> player;
+    std::unique_ptr<GameCamera> camera;
+    EnemyManager enemyManager;
+
+protected:
+    Step resume() override;
+
+private:
+    enum Phase {
+        WAIT_FOR_TILES,
+        CREATE_MAP,
+        CREATE_PLAYER,
+        SPAWN_ENEMIES
+    };
+
+    std::shared_ptr<Core::ResourcePreloadJob> tilePreload;
+    Spawner& spawner;
+    int screenWidth;
+    int screenHeight;
+};
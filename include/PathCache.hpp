@@ -0,0 +1,52 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "map/NavGraph.hpp"
+
+struct PathCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stale = 0;      // entries found but dropped because a tile on their corridor changed
+    uint64_t evictions = 0;
+    size_t entries = 0;
+};
+
+// Recent nav-graph routes, keyed by the spans the start and goal stand on.
+// Any query between the same two spans reuses the route: the caller's own
+// start cell is put in front and its goal cell at the end, both reached by
+// walking along their span. Entries are dropped once a chunk along the
+// route, or under either endpoint, has been repaired since the search.
+// Enemies crowding one room after the player mostly sit on the same few
+// spans, so their repeats become lookups even as everyone moves.
+//
+// Not synchronised; PathfindingService calls it under its own mutex.
+class PathCache {
+public:
+    static constexpr size_t MAX_ENTRIES = 256;
+
+    bool lookup(const NavGraph& graph, Vector2 start, Vector2 goal, std::vector<Vector2>& out);
+    // revision is the one NavGraph::findPath reported for route.
+    void insert(const NavGraph& graph, Vector2 start, Vector2 goal, const std::vector<NavWaypoint>& route, uint64_t revision);
+    void clear();
+
+    PathCacheStats getStats() const;
+
+private:
+    struct Entry {
+        uint64_t revision;
+        uint64_t lastUsed;
+        std::vector<int32_t> corridor;  // distinct chunks the route passes through
+        std::vector<Vector2> path;      // up to the landing on the goal span
+    };
+
+    static uint64_t keyOf(int32_t startSpan, int32_t goalSpan);
+    bool isFresh(const NavGraph& graph, const Entry& entry) const;
+    void evictOldest();
+
+    std::unordered_map<uint64_t, Entry> entries;
+    uint64_t useClock = 0;
+    PathCacheStats stats;
+};
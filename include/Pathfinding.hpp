@@ -1,19 +1,48 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <raylib.h>
+#include "map/NavGraph.hpp"
 
 
 class Map;
 
 
-struct Node {
-    int x, y;
-    float g, f;
-    Node* parent;
-    Node(int x, int y, float g, float f, Node* parent)
-        : x(x), y(y), g(g), f(f), parent(parent) {}
+// 4-connected grid A* over walkable cells (an empty tile with solid ground
+// below). outPath receives tile positions in world space from the first step
+// to the goal and is left empty when the goal is unreachable.
+//
+// Search state lives in per-thread flat arrays sized to the map and is reset
+// by bumping a generation stamp, so after the first search on a thread only
+// growth of outPath can allocate. expansions (optional) counts nodes expanded.
+bool FindPathAStar(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, int* expansions = nullptr);
+std::vector<Vector2> FindPathAStar(const Map& map, Vector2 start, Vector2 goal);
+
+// Same query and result as FindPathAStar, but expands only jump points:
+// straight runs are scanned 64 cells at a time on Map::getTileMask(), so a
+// long corridor costs a handful of expansions instead of one per tile. The
+// mask is refreshed once per tick, so a tile changed this tick may not be
+// seen yet.
+bool FindPathJPS(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, int* expansions = nullptr);
+
+enum class GridSearch {
+    ASTAR,
+    JUMP_POINT
 };
 
+bool FindPathGrid(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, GridSearch mode, int* expansions = nullptr);
+
+// Plans across Map::getNavHierarchy() when start and goal are in different
+// clusters and falls back to the flat grid search otherwise. Only the first
+// leg of the result is tile-exact; see NavHierarchy::findPath.
+bool FindPathHierarchical(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, GridSearch fallback = GridSearch::ASTAR);
+
+// Routes over Map::getNavGraph(), so the result may jump, drop and climb;
+// each waypoint says which. Falls back to FindPathHierarchical (every
+// waypoint a WALK) when the graph has no route between the two points.
+bool FindPathPlatformer(const Map& map, Vector2 start, Vector2 goal, std::vector<NavWaypoint>& outPath);
 
-std::vector<Vector2> FindPathAStar(const Map& map, Vector2 start, Vector2 goal);
\ No newline at end of file
+// Runs the same sampled queries through both grid searches and prints
+// expansions, time and any disagreement in path length.
+void BenchmarkGridSearch(const Map& map, int queryCount, uint64_t seed);
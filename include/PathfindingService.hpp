@@ -0,0 +1,102 @@
+#pragma once
+#include <raylib.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include "PathCache.hpp"
+
+class Map;
+
+// Identifies one requester (an enemy). A handle whose slot has since been
+// released no longer matches, so results addressed to it are discarded.
+struct PathHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool isValid() const { return index != UINT32_MAX; }
+};
+
+// Runs path queries for enemies on a small, fixed number of JobSystem
+// workers. Each handle has at most one outstanding request: asking again
+// before the search starts just replaces start and goal. update() releases
+// at most the per-frame query budget to the workers; finished paths land in
+// the handle's mailbox until the owner polls them.
+//
+// Searches read the map registered with setMap(). setMap() waits for running
+// searches and throws away every queued request and undelivered path, so
+// the old map may be destroyed as soon as it returns.
+//
+// Nav-graph routes are kept in a PathCache; a request whose endpoints stand
+// on the same spans as a cached, still-valid route is answered in update()
+// without reaching a worker and without using the query budget.
+class PathfindingService {
+public:
+    static constexpr int DEFAULT_QUERY_BUDGET = 8;
+    static constexpr int DEFAULT_MAX_WORKERS = 2;
+
+    static PathfindingService& getInstance();
+
+    PathHandle acquire();
+    // Drops the handle's pending request and mailbox. A search already
+    // running for it finishes but its result is discarded.
+    void release(PathHandle handle);
+
+    void request(PathHandle handle, Vector2 start, Vector2 goal);
+    // True from request() until the result has been delivered or dropped.
+    bool isPending(PathHandle handle) const;
+    // Swaps a delivered path into out. Returns false when nothing new arrived.
+    bool poll(PathHandle handle, std::vector<Vector2>& out);
+
+    void setMap(const Map* newMap);
+
+    // Main thread, once per frame.
+    void update();
+
+    void setQueryBudget(int budget) { queryBudget = budget > 0 ? budget : 1; }
+    void setMaxWorkers(int workers) { maxWorkers = workers > 0 ? workers : 1; }
+
+    PathCacheStats getCacheStats() const;
+    void dumpStats() const;
+
+private:
+    struct Slot {
+        uint32_t generation = 0;
+        bool inUse = false;
+        bool queued = false;    // waiting in requestQueue
+        bool running = false;   // handed to a worker
+        bool delivered = false; // mailbox holds a path the owner has not polled
+        Vector2 start = { 0.0f, 0.0f };
+        Vector2 goal = { 0.0f, 0.0f };
+        std::vector<Vector2> mailbox;
+    };
+
+    struct Query {
+        PathHandle handle;
+        Vector2 start;
+        Vector2 goal;
+    };
+
+    PathfindingService() = default;
+    PathfindingService(const PathfindingService&) = delete;
+    PathfindingService& operator=(const PathfindingService&) = delete;
+
+    Slot* findSlot(PathHandle handle);
+    const Slot* findSlot(PathHandle handle) const;
+    void workerLoop();
+    // route is non-null when result came from the nav graph at revision.
+    void deliver(const Query& query, std::vector<Vector2>& result, const std::vector<NavWaypoint>* route, uint64_t revision);
+
+    mutable std::mutex mutex;
+    std::condition_variable idleCondition;
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+    std::deque<uint32_t> requestQueue;  // slot indices, oldest first
+    std::deque<Query> dispatchQueue;    // released to the workers this frame or earlier
+    const Map* map = nullptr;
+    PathCache cache;
+    int activeWorkers = 0;
+    int queryBudget = DEFAULT_QUERY_BUDGET;
+    int maxWorkers = DEFAULT_MAX_WORKERS;
+};
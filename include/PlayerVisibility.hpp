@@ -0,0 +1,59 @@
+#pragma once
+#include <raylib.h>
+#include <cstdint>
+#include <vector>
+#include "map/Raycaster.hpp"
+
+class Map;
+class TileMask;
+
+// Which tiles around the player can see the player, computed once per tick
+// by recursive shadowcasting from the player's tile out to RADIUS. There is
+// one bitmap per RayBlocker, so enemies that look through platforms and
+// enemies that don't each answer "can I see the player?" with a bit lookup,
+// and perception costs two fills however many enemies are looking.
+//
+// Tiles outside the window count as not visible; RADIUS is set past every
+// enemy's engagement range. A tile that itself blocks sight can't see out.
+class PlayerVisibility {
+public:
+    static constexpr int RADIUS = 32;
+
+    static PlayerVisibility& getInstance();
+
+    // Clears both bitmaps. Call whenever the map is swapped or freed.
+    void setMap(const Map* newMap);
+
+    // Once per tick, after the player has moved and tiles have settled.
+    void update(Vector2 playerPosition);
+
+    bool canSeePlayer(Vector2 position, RayBlocker blocker) const;
+
+private:
+    static constexpr int SIDE = RADIUS * 2 + 1;
+    static constexpr int BITMAP_WORDS = (SIDE * SIDE + 63) / 64;
+
+    struct Octant {
+        int xx, xy, yx, yy;
+    };
+
+    PlayerVisibility();
+    PlayerVisibility(const PlayerVisibility&) = delete;
+    PlayerVisibility& operator=(const PlayerVisibility&) = delete;
+
+    bool blocks(int x, int y) const;
+    void markVisible(int x, int y);
+    void castLight(int row, float startSlope, float endSlope, const Octant& octant);
+
+    const Map* map = nullptr;
+    int originX = 0;  // tile coordinates of the window's corner
+    int originY = 0;
+    bool valid = false;
+    std::vector<uint64_t> visible[2];  // per RayBlocker, column-major like the map
+
+    // Fill state, only meaningful inside update().
+    const TileMask* fillMask = nullptr;
+    RayBlocker fillBlocker = RayBlocker::SOLID;
+    int centerX = 0;
+    int centerY = 0;
+};
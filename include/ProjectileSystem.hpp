@@ -0,0 +1,89 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "enemies/EnemyPool.hpp"
+#include "map/Raycaster.hpp"
+
+class Map;
+class Player;
+class EnemyManager;
+
+enum class ProjectileKind : uint8_t {
+    ARROW,           // Bow; trails particles
+    AUTOMATON_SHOT
+};
+
+enum class Faction : uint8_t {
+    PLAYER,  // hits enemies
+    ENEMY    // hits the player
+};
+
+struct ProjectileSpawn {
+    ProjectileKind kind = ProjectileKind::ARROW;
+    Faction faction = Faction::PLAYER;
+    Vector2 position = { 0, 0 };   // hitbox corner
+    Vector2 velocity = { 0, 0 };
+    Vector2 size = { 16, 16 };     // hitbox
+    float lifetime = 1.0f;
+    int damage = 0;
+    EnemyHandle owner;             // firing enemy; invalid for the player's
+    Color trailColor = BLANK;      // ARROW only
+};
+
+// Every projectile in the game, in one fixed-size pool stored as parallel
+// arrays and kept dense by swapping the last projectile into holes, so a
+// tick walks CAPACITY-bounded contiguous memory whatever fired them.
+//
+// update() moves everything in one pass, then sweeps each projectile's
+// hitbox over its step: against the tiles with one Raycaster batch (a ray
+// per corner), against entities through CollisionGrid segment queries on
+// grown hitboxes. A step is tested as a whole, so nothing is substepped and
+// fast projectiles can't tunnel through walls or enemies, as long as
+// hitboxes stay smaller than a tile. Run it after the broadphase has been
+// rebuilt. Hits are submitted to CombatResolver; the player and the enemies
+// are only read.
+class ProjectileSystem {
+public:
+    static constexpr size_t CAPACITY = 4096;
+
+    static ProjectileSystem& getInstance();
+
+    // Returns false, dropping the projectile, when the pool is full.
+    bool spawn(const ProjectileSpawn& projectile);
+    void update(float dt, const Map& map, EnemyManager& enemyManager, const Player& player);
+    void draw() const;
+    void clear();
+
+    size_t getActiveCount() const { return count; }
+
+private:
+    ProjectileSystem();
+    ProjectileSystem(const ProjectileSystem&) = delete;
+    ProjectileSystem& operator=(const ProjectileSystem&) = delete;
+
+    void hitEnemies(size_t i, EnemyManager& enemyManager);
+    void hitPlayer(size_t i, const Player& player);
+    void removeAt(size_t i);
+
+    size_t count = 0;
+
+    // Parallel arrays, CAPACITY long; only [0, count) is live.
+    std::vector<float> posX, posY;
+    std::vector<float> prevX, prevY;
+    std::vector<float> velX, velY;
+    std::vector<float> width, height;
+    std::vector<float> lifetime;
+    std::vector<float> trailTimer;
+    std::vector<int32_t> damage;
+    std::vector<ProjectileKind> kind;
+    std::vector<Faction> faction;
+    std::vector<uint8_t> alive;  // cleared on a hit, removed at the end of update()
+    std::vector<EnemyHandle> owner;
+    std::vector<Color> trailColor;
+
+    std::vector<RaySegment> sweeps;
+    std::vector<RayHit> tileHits;
+    std::vector<uint32_t> candidates;  // CollisionGrid query results
+};
@@ -1,12 +1,21 @@
 #ifndef FAST_RNG_HPP
 #define FAST_RNG_HPP
 
+#include <cstddef>
 #include <cstdint>
 
+// xoshiro256++. Satisfies UniformRandomBitGenerator, so it plugs into
+// <random> distributions and std::shuffle.
 class FastRNG {
 public:
+    using result_type = uint64_t;
+
     explicit FastRNG(uint64_t seed = 0);
 
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+    result_type operator()() { return next(); }
+
     uint64_t next();
 
     uint32_t nextUInt(uint32_t max);
@@ -15,14 +24,24 @@ public:
     int rollPercent();
 
     float nextFloat();
+    float nextFloat(float lo, float hi);
+
+    // Uniform floats in [0, 1) or [lo, hi), two per 64-bit draw.
+    void fillFloats(float* out, size_t count);
+    void fillFloats(float* out, size_t count, float lo, float hi);
 
     void seed(uint64_t seed);
+
+    // Advance by 2^128 and 2^192 draws; used to split non-overlapping streams.
+    void jump();
+    void longJump();
     
 private:
     uint64_t state[4];
     
     static uint64_t rotl(const uint64_t x, int k);
     static uint64_t splitmix64(uint64_t& z);
+    void applyJump(const uint64_t (&polynomial)[4]);
 };
 
 #endif
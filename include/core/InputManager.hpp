@@ -22,6 +22,7 @@ enum class InputAction {
     INTERACT,
     PAUSE,
     DEBUG_TOGGLE,
+    DEBUG_BENCHMARK,
     MENU_UP,
     MENU_DOWN,
     MENU_LEFT,
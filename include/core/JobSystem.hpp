@@ -0,0 +1,178 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Scheduling classes, highest first. A worker always drains FRAME_CRITICAL
+// before touching STREAMING, and STREAMING before IDLE.
+enum class JobPriority {
+    FRAME_CRITICAL = 0, // work the current frame is blocked on
+    STREAMING = 1,      // map generation, asset decoding
+    IDLE = 2,           // latency-tolerant work such as path requests
+    COUNT
+};
+
+// One fork-join loop, owned by the caller's stack frame. Workers and the caller
+// claim [next, next + grain) slices until the range is exhausted, so nothing
+// is heap allocated per chunk. Built by parallel_for() in core/Parallel.hpp.
+struct ParallelRange {
+    void (*invoke)(void* ctx, size_t begin, size_t end) = nullptr;
+    void* ctx = nullptr;
+    std::atomic<size_t> next{0};
+    size_t end = 0;
+    size_t grain = 1;
+
+    int helpersWanted = 0;              // guarded by JobSystem::queueMutex
+    std::atomic<int> activeHelpers{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+
+    // Returns the number of slices this thread executed.
+    size_t run();
+};
+
+// Log2 buckets in microseconds: bucket i holds samples in [2^(i-1), 2^i) us,
+// the last bucket everything slower.
+struct JobHistogram {
+    static constexpr size_t BUCKETS = 20;
+    std::array<uint64_t, BUCKETS> counts{};
+
+    uint64_t total() const;
+    // Upper bound of the bucket holding the p-th percentile (0..1), in us.
+    float percentileUs(float p) const;
+};
+
+// Point-in-time copy of the JobSystem counters. There is no work stealing
+// between per-worker queues (all workers share one queue per priority), so
+// "steals" are a worker joining a parallel_for published by another thread:
+// an attempt when it joins, a success when it still got at least one slice.
+struct JobSystemStats {
+    struct Thread {
+        uint64_t tasksExecuted = 0;
+        uint64_t stealAttempts = 0;
+        uint64_t stealSuccesses = 0;
+        double busyMs = 0.0;
+        JobHistogram queueLatency;
+        JobHistogram execTime;
+    };
+
+    std::vector<Thread> workers;
+    Thread mainThread;  // runOnMainThread() jobs
+    std::array<size_t, static_cast<size_t>(JobPriority::COUNT)> queueDepth{};
+    std::array<size_t, static_cast<size_t>(JobPriority::COUNT)> queueDepthHighWater{};
+    double uptimeSeconds = 0.0;
+};
+
+// Engine-wide worker pool. Sized to hardware_concurrency() - 1 so the main
+// thread keeps a core to itself. raylib is not thread safe: anything touching
+// the window, GL or audio must go through runOnMainThread().
+// The first getInstance() call must happen on the main thread.
+class JobSystem {
+public:
+    static JobSystem& getInstance();
+
+    template<class F>
+    auto submit(JobPriority priority, F&& f)
+        -> std::future<std::invoke_result_t<std::decay_t<F>>>;
+    // Fire-and-forget: no packaged_task and no future, so a callable that
+    // fits std::function's inline buffer (a captured pointer or two) costs
+    // no allocation beyond the queue's own block growth. Exceptions are
+    // logged and dropped.
+    void post(JobPriority priority, std::function<void()> job) { push(priority, std::move(job)); }
+
+    // Runs the range on the calling thread plus up to maxHelpers workers and
+    // returns once every slice is done. Rethrows the first exception raised.
+    void runParallel(ParallelRange& range, size_t maxHelpers);
+
+    void runOnMainThread(std::function<void()> job);
+    size_t processMainThreadJobs(float budgetMs = 2.0f);
+    bool isMainThread() const { return std::this_thread::get_id() == mainThreadId; }
+
+    size_t getWorkerCount() const { return workers.size(); }
+
+    // Counters are written only by the thread that owns them and read with
+    // relaxed loads, so they stay on in release builds.
+    JobSystemStats getStats() const;
+    void dumpStats() const;
+    // Dumps from processMainThreadJobs() every `seconds`; 0 disables.
+    void setStatsDumpInterval(float seconds) { statsDumpInterval = seconds; }
+
+    void waitForAll();
+    void shutdown();
+    bool isShutdown() const { return shutdownFlag.load(std::memory_order_acquire); }
+
+private:
+    JobSystem();
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    static constexpr size_t MAX_PARALLEL_RANGES = 64;
+    using Clock = std::chrono::steady_clock;
+
+    struct QueuedJob {
+        std::function<void()> fn;
+        Clock::time_point enqueuedAt;
+    };
+
+    struct alignas(64) ThreadCounters {
+        std::atomic<uint64_t> tasksExecuted;
+        std::atomic<uint64_t> stealAttempts;
+        std::atomic<uint64_t> stealSuccesses;
+        std::atomic<uint64_t> busyNs;
+        std::array<std::atomic<uint64_t>, JobHistogram::BUCKETS> queueLatency;
+        std::array<std::atomic<uint64_t>, JobHistogram::BUCKETS> execTime;
+    };
+
+    void push(JobPriority priority, std::function<void()> job);
+    void workerLoop(size_t index);
+    void removeParallelRange(ParallelRange* range);
+    void runCounted(QueuedJob& job, ThreadCounters& counters);
+    static JobSystemStats::Thread readCounters(const ThreadCounters& counters);
+
+    std::vector<std::thread> workers;
+    std::array<std::deque<QueuedJob>, static_cast<size_t>(JobPriority::COUNT)> queues;
+    std::mutex queueMutex;
+    std::condition_variable condition;
+    std::condition_variable finished;
+    size_t activeJobs = 0;
+    std::array<ParallelRange*, MAX_PARALLEL_RANGES> parallelRanges{};
+    size_t parallelRangeCount = 0;
+    std::atomic<bool> shutdownFlag{false};
+
+    // One slot per worker plus one for the main thread, last.
+    std::unique_ptr<ThreadCounters[]> counters;
+    size_t mainCounterIndex = 0;
+    std::array<std::atomic<size_t>, static_cast<size_t>(JobPriority::COUNT)> queueDepth{};
+    std::array<std::atomic<size_t>, static_cast<size_t>(JobPriority::COUNT)> queueDepthHighWater{};
+    Clock::time_point startTime;
+    float statsDumpInterval = 0.0f;
+    Clock::time_point lastStatsDump;
+
+    std::deque<QueuedJob> mainThreadJobs;
+    std::mutex mainThreadMutex;
+    std::thread::id mainThreadId;
+};
+
+template<class F>
+auto JobSystem::submit(JobPriority priority, F&& f)
+    -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+    using return_type = std::invoke_result_t<std::decay_t<F>>;
+
+    auto task = std::make_shared<std::packaged_task<return_type()>>(std::forward<F>(f));
+    std::future<return_type> res = task->get_future();
+    push(priority, [task]() { (*task)(); });
+    return res;
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "core/JobSystem.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Thrown by LongJob::throwIfCancelled() so deep call chains (map generation
+// progress callbacks) unwind as soon as a cancel is seen.
+class JobCancelled : public std::exception {
+public:
+    const char* what() const noexcept override { return "job cancelled"; }
+};
+
+// Long-running, resumable job. Subclasses implement resume() as a stackless
+// state machine: each call advances `state`, does one slice of work and says
+// what to do next. Between slices the job holds no worker, so a cancelled
+// job gives its thread back at the next yield point instead of running to
+// completion.
+//
+//   YIELD  reschedule immediately (cooperative yield point)
+//   AWAIT  suspend until the job passed to awaitJob() finishes
+//   DONE   finished successfully
+//
+// Cancelling a job also cancels a sub-job it started itself. Sub-jobs that
+// were already running (shared with other jobs) are only detached from.
+class LongJob : public std::enable_shared_from_this<LongJob> {
+public:
+    enum class Status {
+        PENDING,
+        RUNNING,
+        WAITING,
+        DONE,
+        CANCELLED,
+        FAILED
+    };
+
+    enum class Affinity {
+        WORKER,
+        MAIN_THREAD // every slice runs from JobSystem::processMainThreadJobs()
+    };
+
+    explicit LongJob(const char* name, JobPriority priority = JobPriority::STREAMING, Affinity affinity = Affinity::WORKER);
+    virtual ~LongJob() = default;
+
+    static void start(const std::shared_ptr<LongJob>& job);
+
+    void cancel();
+    bool isCancelled() const { return cancelled.load(std::memory_order_acquire); }
+
+    Status getStatus() const { return status.load(std::memory_order_acquire); }
+    bool isFinished() const;
+    // Blocks until the job has finished. Must not be called from the thread
+    // the job needs to make progress (main thread for MAIN_THREAD jobs).
+    void wait();
+
+    float getProgress() const { return progress.load(std::memory_order_relaxed); }
+    const char* getPhase() const { return phase.load(std::memory_order_relaxed); }
+    const char* getName() const { return name; }
+
+protected:
+    enum class Step {
+        YIELD,
+        AWAIT,
+        DONE
+    };
+
+    virtual Step resume() = 0;
+
+    // Call from resume() and return Step::AWAIT. Starts the child if it has
+    // not been started yet.
+    void awaitJob(const std::shared_ptr<LongJob>& child);
+    void reportProgress(float fraction, const char* phaseName);
+    void throwIfCancelled() const;
+
+    int state = 0;
+
+private:
+    void schedule();
+    void runSlice();
+    void finish(Status result);
+    bool addContinuation(const std::shared_ptr<LongJob>& parent);
+    bool removeContinuation(const LongJob* parent);
+
+    const char* name;
+    JobPriority priority;
+    Affinity affinity;
+
+    std::atomic<Status> status{Status::PENDING};
+    std::atomic<bool> cancelled{false};
+    std::atomic<float> progress{0.0f};
+    std::atomic<const char*> phase{""};
+
+    std::mutex mutex;
+    std::condition_variable finishedCondition;
+    std::vector<std::shared_ptr<LongJob>> continuations;
+    std::shared_ptr<LongJob> pendingChild;  // set by awaitJob(), consumed by runSlice()
+    std::shared_ptr<LongJob> awaitedChild;
+    bool ownsAwaitedChild = false;
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include "core/JobSystem.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+// Fork-join helpers on top of JobSystem. The calling thread always works on
+// the range itself, so these are safe to nest inside jobs and never block on
+// a saturated pool. Loop bodies receive half-open slices [begin, end).
+//
+// grain == 0 picks a slice size that gives every participant ~4 slices.
+
+namespace ParallelDetail {
+    inline size_t autoGrain(size_t count, size_t participants) {
+        return std::max<size_t>(1, count / (participants * 4));
+    }
+
+    template<class Fn>
+    void invokeSlice(void* ctx, size_t begin, size_t end) {
+        (*static_cast<Fn*>(ctx))(begin, end);
+    }
+}
+
+template<class Fn>
+void parallel_for(size_t begin, size_t end, size_t grain, Fn&& fn) {
+    if (end <= begin) return;
+
+    auto& jobs = JobSystem::getInstance();
+    size_t count = end - begin;
+    size_t participants = jobs.getWorkerCount() + 1;
+    if (grain == 0) grain = ParallelDetail::autoGrain(count, participants);
+
+    if (count <= grain || jobs.isShutdown()) {
+        fn(begin, end);
+        return;
+    }
+
+    auto body = [&fn, begin](size_t b, size_t e) { fn(begin + b, begin + e); };
+
+    ParallelRange range;
+    range.invoke = &ParallelDetail::invokeSlice<decltype(body)>;
+    range.ctx = &body;
+    range.end = count;
+    range.grain = grain;
+
+    size_t slices = (count + grain - 1) / grain;
+    jobs.runParallel(range, std::min(slices - 1, participants - 1));
+}
+
+template<class Fn>
+void parallel_for(size_t begin, size_t end, Fn&& fn) {
+    parallel_for(begin, end, 0, std::forward<Fn>(fn));
+}
+
+// fn(begin, end) returns the partial result for its slice; combine(a, b)
+// folds two partials. Partials are folded in completion order, so combine
+// must be associative and commutative.
+template<class T, class Fn, class Combine>
+T parallel_reduce(size_t begin, size_t end, size_t grain, T identity, Fn&& fn, Combine&& combine) {
+    T result = identity;
+    std::mutex resultMutex;
+    parallel_for(begin, end, grain, [&](size_t b, size_t e) {
+        T partial = fn(b, e);
+        std::lock_guard<std::mutex> lock(resultMutex);
+        result = combine(result, partial);
+    });
+    return result;
+}
+
+template<class... Fns>
+void parallel_invoke(Fns&&... fns) {
+    static_assert(sizeof...(Fns) > 0, "parallel_invoke needs at least one callable");
+    parallel_for(0, sizeof...(Fns), 1, [&](size_t b, size_t e) {
+        for (size_t i = b; i < e; ++i) {
+            size_t index = 0;
+            ((index++ == i ? (void)fns() : (void)0), ...);
+        }
+    });
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "core/LongJob.hpp"
+#include "core/ResourceManager.hpp"
+#include <string>
+#include <vector>
+
+namespace Core {
+
+// Incremental ResourceManager::preloadBatch(). Texture uploads need the GL
+// context, so slices run on the main thread and load one file each; the
+// main-thread job budget decides how many land per frame.
+class ResourcePreloadJob : public LongJob {
+public:
+    explicit ResourcePreloadJob(std::vector<std::string> texturePaths,
+                                std::vector<std::string> soundPaths = {},
+                                std::vector<std::string> musicPaths = {});
+
+    // Valid handles in texturePaths order. Only read once the job is DONE.
+    const std::vector<ResourceHandle<Texture2D>>& getTextures() const { return textures; }
+
+protected:
+    Step resume() override;
+
+private:
+    enum Phase {
+        TEXTURES,
+        SOUNDS,
+        MUSIC
+    };
+
+    std::vector<std::string> texturePaths;
+    std::vector<std::string> soundPaths;
+    std::vector<std::string> musicPaths;
+    std::vector<ResourceHandle<Texture2D>> textures;
+    size_t nextIndex = 0;
+    size_t loadedCount = 0;
+};
+
+}
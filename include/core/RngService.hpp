@@ -0,0 +1,56 @@
+#pragma once
+#include "core/FastRNG.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+enum class RngStream {
+    MAP_GENERATION,
+    SPAWNING,
+    AUTOMATA,
+    PARTICLES,
+    CAMERA,
+    GAMEPLAY,
+    COUNT
+};
+
+// Every random number in a run derives from one run seed. Each subsystem owns
+// a 2^192-long slice of the xoshiro sequence (long jumps from the root), so
+// streams never overlap:
+//
+//   stream(id)       the subsystem's deterministic stream
+//   split(id, n)     n sub-streams 2^128 draws apart, for fanning out
+//                    deterministic work (per room, per slice)
+//   local(id)        this thread's own stream. Which one a thread gets
+//                    depends on scheduling, so its draws don't replay from
+//                    the seed: cosmetic, order-insensitive uses only (shake,
+//                    particles). Anything that affects gameplay keeps
+//                    stream()/split() state and advances it in a fixed order.
+class RngService {
+public:
+    static RngService& getInstance();
+
+    // 0 picks a seed from the clock. Call between runs, not during a tick.
+    void setRunSeed(uint64_t seed);
+    uint64_t getRunSeed() const { return runSeed.load(std::memory_order_acquire); }
+
+    FastRNG stream(RngStream id) const;
+    void split(RngStream id, size_t count, std::vector<FastRNG>& out) const;
+    FastRNG& local(RngStream id);
+
+private:
+    static constexpr size_t STREAM_COUNT = static_cast<size_t>(RngStream::COUNT);
+
+    RngService();
+    RngService(const RngService&) = delete;
+    RngService& operator=(const RngService&) = delete;
+
+    mutable std::mutex mutex;
+    std::atomic<uint64_t> runSeed{0};
+    std::atomic<uint32_t> generation{0};
+    std::atomic<uint32_t> nextThreadSlot{0};
+    std::array<FastRNG, STREAM_COUNT> subsystemBase;
+    std::array<FastRNG, STREAM_COUNT> threadBase;
+};
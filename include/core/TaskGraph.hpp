@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using TaskResourceMask = uint32_t;
+
+// Declarative per-tick graph. Tasks are added in the order the serial code
+// would run them; two tasks get an edge when one writes a resource the
+// other reads or writes, so independent stages overlap on the JobSystem
+// while conflicting ones keep their original order. Particle emission goes
+// through ParticleSystem's lock-free ring and does not need to be declared.
+class TaskGraph {
+public:
+    using TaskFn = std::function<void()>;
+
+    struct TaskTiming {
+        const char* name;
+        float startMs;
+        float durationMs;
+    };
+
+    int addTask(const char* name, TaskResourceMask reads, TaskResourceMask writes, TaskFn fn, bool mainThreadOnly = false);
+    void clear();
+
+    // Runs every task once and returns when all have finished. The calling
+    // thread runs main-thread-only tasks and helps with the rest.
+    void execute();
+
+    float getLastFrameMs() const { return lastFrameMs; }
+    float getCriticalPathMs() const;
+    const std::vector<TaskTiming>& getCriticalPath() const { return criticalPath; }
+    void printCriticalPath() const;
+
+private:
+    struct Task {
+        const char* name;
+        TaskResourceMask reads;
+        TaskResourceMask writes;
+        TaskFn fn;
+        bool mainThreadOnly;
+        std::vector<int> successors;
+        int dependencyCount = 0;
+        int readyBy = -1;
+        float startMs = 0.0f;
+        float endMs = 0.0f;
+    };
+
+    void build();
+    void dispatch(int index);
+    void runTask(int index);
+    void runOneReady();
+    void recordCriticalPath();
+    float msSinceFrameStart() const;
+
+    std::vector<Task> tasks;
+    std::unique_ptr<std::atomic<int>[]> pending;
+    bool dirty = true;
+
+    std::mutex readyMutex;
+    std::condition_variable readyCondition;
+    std::vector<int> readyTasks;
+    std::vector<int> mainReadyTasks;
+    size_t completedTasks = 0;
+
+    std::chrono::steady_clock::time_point frameStart;
+    float lastFrameMs = 0.0f;
+    std::vector<TaskTiming> criticalPath;
+};
@@ -0,0 +1,24 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+
+struct ParticleStreams;
+
+// Which pass draws a particle. AMBIENT particles (tile pops, suction, dust)
+// are drawn with the map, behind the player; everything else over it.
+enum class ParticleLayer : uint8_t {
+    BEHIND_ACTORS,
+    IN_FRONT
+};
+
+// Writes one quad (two triangles, six vertices) per particle in `layer` that
+// overlaps `view`: xyz per vertex into `positions`, rgba per vertex into
+// `colors`. Stops after maxQuads and returns how many quads were written.
+// Pure CPU, no raylib calls, so it can run anywhere.
+size_t buildParticleQuads(const ParticleStreams& particles, Rectangle view, ParticleLayer layer,
+                          float* positions, unsigned char* colors, size_t maxQuads);
+
+// Texture coordinates are identical for every quad, so they are written
+// once per buffer instead of every frame.
+void fillParticleQuadTexcoords(float* texcoords, size_t quads);
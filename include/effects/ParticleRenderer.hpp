@@ -0,0 +1,25 @@
+#pragma once
+#include "effects/ParticleQuads.hpp"
+#include <raylib.h>
+#include <cstddef>
+
+// Draws every visible particle of a layer as a textured quad from one
+// dynamic mesh, i.e. one draw call per layer per frame. GL resources are
+// created on first draw and must be released with unload() while the window
+// is still open.
+class ParticleRenderer {
+public:
+    static constexpr int SPRITE_SIZE = 32;
+    static constexpr size_t INITIAL_QUADS = 4096;
+
+    void draw(const ParticleStreams& particles, Rectangle view, ParticleLayer layer);
+    void unload();
+
+private:
+    void ensureCapacity(size_t quads);
+
+    Mesh mesh = {};
+    Material material = {};
+    size_t capacityQuads = 0;
+    bool loaded = false;
+};
@@ -1,9 +1,19 @@
 #pragma once
+#include "effects/ParticleRenderer.hpp"
 #include <raylib.h>
-#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
-#include <queue>
-#include <functional>
+#include <vector>
+
+// Per-emitter importance class. Over budget, lower classes are culled first.
+enum class ParticlePriority : uint8_t {
+    AMBIENT = 0,  // tile pops, suction, dust
+    EFFECT = 1,   // hit sparks, explosions
+    GAMEPLAY = 2  // particles that tell the player something
+};
 
 struct Particle {
     Vector2 position;
@@ -12,36 +22,95 @@ struct Particle {
     float life;
     float maxLife;
     float size;
+    ParticlePriority priority;
 };
 
-struct ParticleCreationJob {
-    std::vector<Particle> particles;
-    std::function<void(std::vector<Particle>&)> creationFunction;
+// Every live particle in the game, map and combat effects alike, as parallel
+// streams; index i across all of them is one particle. Storage is allocated
+// once at capacity, the integrate kernel touches only the streams it needs,
+// and dead particles are removed by swap-and-pop, so order is not stable.
+struct ParticleStreams {
+    std::vector<float> px, py;
+    std::vector<float> vx, vy;
+    std::vector<float> life, invMaxLife;
+    std::vector<float> alpha;   // 0..1, written by the integrator
+    std::vector<float> radius;
+    std::vector<Color> color;   // base rgb, alpha comes from the alpha stream
+    std::vector<ParticlePriority> priority;
+    size_t count = 0;
+
+    void allocate(size_t capacity);
+    size_t size() const { return count; }
+    size_t capacity() const { return px.size(); }
+    bool empty() const { return count == 0; }
+    bool push(const Particle& particle);
+    void swapRemove(size_t index);
+    void clear() { count = 0; }
 };
 
 class ParticleSystem {
 public:
+    static constexpr size_t MAX_PARTICLES = 1 << 17;
+    static constexpr size_t EMISSION_CAPACITY = 1 << 14;
+    static constexpr size_t DEFAULT_BUDGET = 100000;
+
     static ParticleSystem& getInstance();
-    
+
+    // Copies `count` ready-made particles into the emission ring. Safe from
+    // any thread; drops the batch when the ring is full.
+    void emit(const Particle* source, int count);
     void createExplosion(Vector2 position, int count, Color color, float duration, float speed = 100.0f);
     void update(float deltaTime);
-    void draw();
+    // Also records the view that the next update() culls against.
+    // Call once per layer: BEHIND_ACTORS right after the map, IN_FRONT after
+    // the player.
+    void draw(const Camera2D& camera, ParticleLayer layer);
     void clear();
-    
+    // Releases GL resources; call before the window closes.
+    void unloadRenderResources();
+
+    // Soft cap on live particles, at most MAX_PARTICLES.
+    void setBudget(size_t budget) { particleBudget = std::min(budget, MAX_PARTICLES); }
+    size_t getBudget() const { return particleBudget; }
+    size_t getParticleCount() const { return particles.size(); }
+
     void createDustParticle(Vector2 position, Vector2 velocity, float lifetime);
     void createExplosionParticles(Vector2 position, int count, Color baseColor);
 
 private:
-    std::vector<Particle> particles;
-    std::queue<std::vector<Particle>> pendingParticles;
+    // One slot of the emission ring. A slot holding ring position `pos` is
+    // readable once sequence == pos + 1.
+    struct EmissionSlot {
+        std::atomic<size_t> sequence;
+        Particle particle;
+    };
+
+    ParticleStreams particles;
+    std::vector<uint8_t> importance;  // scratch for cullToBudget()
     std::mutex particleMutex;
-    std::mutex pendingMutex;
-    
+    size_t particleBudget = DEFAULT_BUDGET;
+    Rectangle lastView = { 0.0f, 0.0f, 0.0f, 0.0f };
+    ParticleRenderer renderer;
+
+    // Bounded multi-producer, single-consumer ring. Emitters on any thread
+    // claim a run of slots with one CAS on emissionHead, fill them in place
+    // and publish each slot's sequence; update() drains published slots in
+    // order and advances emissionTail. A full ring drops the emission.
+    std::unique_ptr<EmissionSlot[]> emissionRing;
+    alignas(64) std::atomic<size_t> emissionHead{0};
+    alignas(64) std::atomic<size_t> emissionTail{0};
+
     ParticleSystem();
-    
+
     ParticleSystem(const ParticleSystem&) = delete;
     ParticleSystem& operator=(const ParticleSystem&) = delete;
-    
+
+    bool reserveEmission(size_t count, size_t& first);
+    Particle& emissionSlot(size_t position) { return emissionRing[position & (EMISSION_CAPACITY - 1)].particle; }
+    void publishEmission(size_t position);
+
     void processPendingParticles();
     void updateParticleRange(size_t start, size_t end, float deltaTime);
+    void removeDeadParticles();
+    void cullToBudget();
 };
@@ -0,0 +1,75 @@
+#pragma once
+#include <raylib.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "enemies/EnemyPool.hpp"
+
+class Map;
+
+enum class AiTier : uint8_t {
+    ACTIVE,   // every tick
+    REDUCED,  // every REDUCED_INTERVAL ticks with the time it missed
+    DORMANT   // frozen until the player enters its room
+};
+
+// Decides how often each enemy's AI runs. Enemies near the player, able to
+// see the player or sharing the player's room run every tick. Enemies in
+// another room and beyond WAKE_RANGE go dormant and stay so until the
+// player enters that room or gets close. Everything else, mostly corridor
+// enemies, runs every REDUCED_INTERVAL ticks, staggered by slot.
+//
+// Skipped time is handed back when the enemy next runs, in steps of at most
+// MAX_CATCH_UP_STEP (what a 30 fps frame already gives it) so movement
+// can't tunnel through tiles. Dormant enemies drop their time.
+//
+// State is kept per pool slot, so schedule() may run in parallel for
+// different enemies; track() and beginTick() may not.
+class AiLodScheduler {
+public:
+    AiLodScheduler();
+
+    static constexpr float ACTIVE_RANGE = 800.0f;
+    static constexpr float WAKE_RANGE = 1600.0f;
+    static constexpr uint32_t REDUCED_INTERVAL = 4;
+    static constexpr float MAX_CATCH_UP_STEP = 1.0f / 30.0f;
+
+    // Call when an enemy is created; resets its slot.
+    void track(EnemyHandle handle);
+
+    void beginTick(const Map& map, Vector2 playerPos);
+
+    // Returns how many updates of stepDt the enemy gets this tick (often 0).
+    int schedule(EnemyHandle handle, Vector2 position, float dt, float& stepDt);
+
+    size_t getTierCount(AiTier tier) const { return tierCounts[static_cast<int>(tier)].load(std::memory_order_relaxed); }
+    void dumpStats() const;
+
+private:
+    struct State {
+        float pendingDt = 0.0f;
+        AiTier tier = AiTier::ACTIVE;
+    };
+
+    static constexpr int TYPE_COUNT = 3;
+    static constexpr int TIER_COUNT = 3;
+
+    void buildRoomIndex(const Map& map);
+    int roomAt(Vector2 position) const;
+    AiTier classify(const State& state, Vector2 position) const;
+
+    std::vector<State> states[TYPE_COUNT];  // per EnemyType, by pool slot
+    std::unique_ptr<std::atomic<uint32_t>[]> tierCounts;  // this tick, per AiTier
+
+    const Map* indexedMap = nullptr;
+    size_t indexedRoomCount = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<int16_t> roomIndex;  // per tile, column-major, -1 outside rooms
+
+    uint32_t tick = 0;
+    Vector2 playerPos = { 0, 0 };
+    int playerRoom = -1;
+};
@@ -6,20 +6,7 @@
 #include "map/Map.hpp"
 #include "enemies/Enemy.hpp"
 
-class AutomatonProjectile {
-public:
-    Vector2 position;
-    Vector2 velocity;
-    bool active = true;
-    float lifetime = 2.0f;
-    float age = 0.0f;
-    AutomatonProjectile(Vector2 pos, Vector2 vel) : position(pos), velocity(vel) {}
-    void update(float dt, const Map& map);
-    void draw() const;
-    Rectangle getHitbox() const;
-};
-
-class Automaton : public Enemy {
+class Automaton final : public Enemy {
 public:
 
     Automaton(const Automaton&) = delete;
@@ -29,20 +16,15 @@ public:
     Automaton& operator=(Automaton&&) noexcept;
     
     Automaton(Vector2 pos);
-    void update(const Map& map, Vector2 playerPos, float dt) override;
+    // Firing needs a command buffer, so only the overload below does anything.
+    void update(const Map&, Vector2, float) override {}
+    void update(const Map& map, Vector2 playerPos, float dt, EnemyCommandBuffer& commands) override;
     void draw() const override;
     Rectangle getHitbox() const override;
     EnemyType getType() const override { return EnemyType::AUTOMATON; }
     EnemySpawnConfig getSpawnConfig() const override;
-    void requestPathAsync(const Map& map, Vector2 start, Vector2 goal) override;
-    std::vector<AutomatonProjectile>& getProjectiles() { return projectiles; }
-    void updateProjectiles(float dt, const Map& map);
-    void checkProjectileCollisions(class Player& player, class GameCamera& camera);
-    
-    bool hasLineOfSight(const Map& map, Vector2 start, Vector2 end) const;
     
 private:
     float shootCooldown = 0.0f;
     float shootInterval = 1.5f;
-    std::vector<AutomatonProjectile> projectiles;
 };
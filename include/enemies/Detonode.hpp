@@ -6,7 +6,7 @@
 
 class Map;
 
-class Detonode : public Enemy {
+class Detonode final : public Enemy {
 public:
     enum State {
         IDLE,
@@ -24,13 +24,12 @@ public:
     
     Detonode(Vector2 pos);
     void update(const Map& map, Vector2 playerPos, float dt) override {}
-    void update(Map& map, Vector2 playerPos, float dt, class GameCamera& camera) override;
+    void update(const Map& map, Vector2 playerPos, float dt, EnemyCommandBuffer& commands) override;
     void draw() const override;
     void applyKnockback(Vector2 force) override;
     Rectangle getHitbox() const override;
     EnemyType getType() const override { return EnemyType::DETONODE; }
     EnemySpawnConfig getSpawnConfig() const override;
-    void requestPathAsync(const Map& map, Vector2 start, Vector2 goal) override;
 
 private:
     State currentState = IDLE;
@@ -49,14 +48,8 @@ private:
     float approachDistance = 64.0f;
     float blinkDuration = 3.0f;
 
-    mutable bool cachedLineOfSightResult = false;
-    mutable float lineOfSightTimer = 0.0f;
-    mutable Vector2 lastPlayerPosForLOS;
-    static constexpr float lineOfSightCacheTime = 0.5f;
-    
-    bool hasLineOfSight(const Map& map, Vector2 start, Vector2 end) const;
-    void explode(Map& map, class GameCamera& camera);
-    void createBlinkParticles();
-    void createExplosionParticles();
-    void removePlatformTiles(Map& map, Vector2 center, float radius);
+    void explode(const Map& map, Vector2 playerPos, EnemyCommandBuffer& commands);
+    void createBlinkParticles(EnemyCommandBuffer& commands);
+    void createExplosionParticles(EnemyCommandBuffer& commands);
+    void removePlatformTiles(const Map& map, Vector2 center, float radius, EnemyCommandBuffer& commands);
 };
@@ -1,11 +1,10 @@
 #pragma once
+#include "PathfindingService.hpp"
 #include <raylib.h>
-#include <atomic>
-#include <mutex>
 #include <vector>
 
 class Map;
-class GameCamera;
+class EnemyCommandBuffer;
 
 enum class EnemyType {
     SCRAP_HOUND,
@@ -22,7 +21,7 @@ struct EnemySpawnConfig {
 class Enemy {
 public:
     Enemy(Vector2 pos, int hp, int maxHp, float spd);
-    virtual ~Enemy() = default;
+    virtual ~Enemy();
 
     Enemy(const Enemy&) = delete;
     Enemy& operator=(const Enemy&) = delete;
@@ -30,7 +29,9 @@ public:
     Enemy& operator=(Enemy&&) noexcept;
 
     virtual void update(const Map& map, Vector2 playerPos, float dt) = 0;
-    virtual void update(Map& map, Vector2 playerPos, float dt, GameCamera& camera) {}
+    // Runs in parallel with other enemies: read the world, write only this
+    // enemy, and record anything else in commands.
+    virtual void update(const Map& map, Vector2 playerPos, float dt, EnemyCommandBuffer&) { update(map, playerPos, dt); }
     virtual void draw() const = 0;
     virtual void takeDamage(int amount);
     virtual void applyKnockback(Vector2 force);
@@ -44,12 +45,13 @@ public:
     float getHealth() const { return health; }
     float getMaxHealth() const { return maxHealth; }
 
-    mutable std::mutex pathMutex;
-    std::atomic<bool> pathfindingInProgress = false;
-    std::atomic<bool> pathReady = false;
-    virtual void requestPathAsync(const Map& map, Vector2 start, Vector2 goal) = 0;
-
 protected:
+    // Paths come from PathfindingService; pollPath() moves a finished one
+    // into `path` and returns true on the frame it arrives.
+    void requestPath(Vector2 start, Vector2 goal);
+    bool isPathPending() const;
+    bool pollPath();
+
     Vector2 position;
     Vector2 velocity;
     float health;
@@ -60,4 +62,7 @@ protected:
     Color currentColor = WHITE;
     float speed;
     std::vector<Vector2> path;
+    PathHandle pathHandle;
+    int repathTimer = 0;
+    Vector2 lastRepathTarget = { 0, 0 };
 };
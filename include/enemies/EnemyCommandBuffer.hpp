@@ -0,0 +1,65 @@
+#pragma once
+#include <raylib.h>
+#include <cstdint>
+#include <vector>
+#include "ProjectileSystem.hpp"
+
+class Map;
+class GameCamera;
+
+enum class EnemyCommandType : uint8_t {
+    REMOVE_PLATFORM,   // tileX, tileY
+    HIT_PLAYER,        // amount (damage), vector (knockback)
+    SHAKE_CAMERA,      // intensity, duration
+    PARTICLES,         // position, count, color
+    EXPLOSION,         // position, count, color, duration, speed
+    FIRE_PROJECTILE    // amount indexes the buffer's projectiles
+};
+
+struct EnemyCommand {
+    EnemyCommandType type;
+    int tileX = 0;
+    int tileY = 0;
+    int amount = 0;
+    Vector2 position = { 0, 0 };
+    Vector2 vector = { 0, 0 };
+    float intensity = 0.0f;
+    float duration = 0.0f;
+    float speed = 0.0f;
+    Color color = WHITE;
+};
+
+// World changes an enemy wants to make, recorded while enemies update in
+// parallel and applied later on one thread. Enemy AI only reads the map,
+// the player and the camera; everything it would write goes through here.
+// Damage is not applied here but handed on to CombatResolver.
+class EnemyCommandBuffer {
+public:
+    void removePlatform(int tileX, int tileY);
+    // Submitted to CombatResolver as an explosion hit.
+    void hitPlayer(int damage, Vector2 knockback);
+    void shakeCamera(float intensity, float duration);
+    void particles(Vector2 position, int count, Color color);
+    void explosion(Vector2 position, int count, Color color, float duration, float speed);
+    // Stamped with the source enemy as owner.
+    void fireProjectile(const ProjectileSpawn& projectile);
+
+    // The enemy whose commands follow.
+    void setSource(EnemyHandle handle) { source = handle; }
+
+    // Applies the commands in the order they were recorded, then clears them.
+    void apply(Map& map, GameCamera& camera);
+
+    bool empty() const { return commands.empty(); }
+    void clear() {
+        commands.clear();
+        projectiles.clear();
+    }
+
+private:
+    EnemyCommand& push(EnemyCommandType type);
+
+    std::vector<EnemyCommand> commands;
+    std::vector<ProjectileSpawn> projectiles;
+    EnemyHandle source;
+};
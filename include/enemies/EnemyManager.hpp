@@ -1,15 +1,58 @@
 #pragma once
 #include "enemies/Enemy.hpp"
+#include "enemies/AiLodScheduler.hpp"
+#include "enemies/EnemyCommandBuffer.hpp"
+#include "enemies/EnemyPool.hpp"
 #include "enemies/ScrapHound.hpp"
-
+#include "enemies/Automaton.hpp"
 #include "enemies/Detonode.hpp"
-#include <vector>
-#include <memory>
+#include <cstddef>
+#include <iterator>
 
 class Map;
 class Player;
 class GameCamera;
+class EnemyManager;
+
+// Every enemy of every pool, in pool order, without building a list.
+// Includes enemies killed since the last removeDeadEnemies(); check
+// isAlive(). Indices are only valid until the next spawn or removal.
+class EnemyView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Enemy;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Enemy*;
+        using reference = Enemy&;
+
+        iterator(const EnemyView* view, size_t index) : view(view), index(index) {}
+        Enemy& operator*() const { return (*view)[index]; }
+        Enemy* operator->() const { return &(*view)[index]; }
+        iterator& operator++() { ++index; return *this; }
+        bool operator==(const iterator& other) const { return index == other.index; }
+        bool operator!=(const iterator& other) const { return index != other.index; }
+
+    private:
+        const EnemyView* view;
+        size_t index;
+    };
+
+    explicit EnemyView(EnemyManager& manager) : manager(manager) {}
+
+    size_t size() const;
+    Enemy& operator[](size_t i) const;
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, size()); }
 
+private:
+    EnemyManager& manager;
+};
+
+// Enemies live in one EnemyPool per type. Updates run per pool with the
+// concrete type known, so there is no per-enemy virtual dispatch or type
+// test, and nothing on the per-frame paths allocates.
 class EnemyManager {
 public:
     EnemyManager() = default;
@@ -21,18 +64,35 @@ public:
     EnemyManager(EnemyManager&&) = default;
     EnemyManager& operator=(EnemyManager&&) = default;
 
-    void addEnemy(std::unique_ptr<Enemy> enemy);
+    EnemyHandle spawnEnemy(EnemyType type, Vector2 position);
+    // Null once the enemy has been removed.
+    Enemy* getEnemy(EnemyHandle handle);
+
     void removeDeadEnemies();
-    void updateEnemies(const Map& map, Vector2 playerPos, float dt);
-    void updateEnemies(Map& map, Vector2 playerPos, float dt, GameCamera& camera);
+    // AI runs in parallel against a read-only world, as often as the LOD
+    // scheduler allows; the changes it asks for are applied afterwards, in
+    // enemy order, on the calling thread.
+    void updateEnemies(Map& map, const Player& player, float dt, GameCamera& camera);
     void drawEnemies() const;
     void clearEnemies();
     
-    std::vector<Enemy*> getEnemiesOfType(EnemyType type) const;
-    std::vector<Enemy*> getAllEnemies() const;
-    size_t getEnemyCount() const { return enemies.size(); }
+    EnemyPool<ScrapHound>& getScrapHounds() { return scrapHounds; }
+    EnemyPool<Automaton>& getAutomatons() { return automatons; }
+    EnemyPool<Detonode>& getDetonodes() { return detonodes; }
+    EnemyView getAllEnemies() { return EnemyView(*this); }
+    const AiLodScheduler& getLodScheduler() const { return lodScheduler; }
+
+    size_t getEnemyCount() const { return scrapHounds.size() + automatons.size() + detonodes.size(); }
     size_t getEnemyCountOfType(EnemyType type) const;
 
 private:
-    std::vector<std::unique_ptr<Enemy>> enemies;
+    friend class EnemyView;
+
+    static constexpr size_t AI_GRAIN = 16;
+
+    EnemyPool<ScrapHound> scrapHounds;
+    EnemyPool<Automaton> automatons;
+    EnemyPool<Detonode> detonodes;
+    std::vector<EnemyCommandBuffer> commandBuffers;  // one per AI_GRAIN slice
+    AiLodScheduler lodScheduler;
 };
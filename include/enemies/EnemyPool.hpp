@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "enemies/Enemy.hpp"
+
+// Names one enemy across frames. Stale once the enemy is removed, even if
+// its slot has been reused.
+struct EnemyHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+    EnemyType type = EnemyType::SCRAP_HOUND;
+
+    bool isValid() const { return index != UINT32_MAX; }
+};
+
+// Enemies of one concrete type stored by value in a dense vector, so a
+// batch update walks contiguous memory and calls T's members directly.
+// Removal swaps the last enemy into the hole; handles go through a slot
+// table and stay valid across those moves. References and iterators do
+// not survive create() or removal.
+template <typename T>
+class EnemyPool {
+public:
+    template <typename... Args>
+    EnemyHandle create(Args&&... args) {
+        uint32_t slot;
+        if (freeSlots.empty()) {
+            slot = static_cast<uint32_t>(slots.size());
+            slots.emplace_back();
+        } else {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        slots[slot].dense = static_cast<uint32_t>(items.size());
+        items.emplace_back(std::forward<Args>(args)...);
+        denseSlots.push_back(slot);
+        return { slot, slots[slot].generation, items.back().getType() };
+    }
+
+    T* get(EnemyHandle handle) {
+        if (handle.index >= slots.size() || slots[handle.index].generation != handle.generation) return nullptr;
+        return &items[slots[handle.index].dense];
+    }
+
+    const T* get(EnemyHandle handle) const {
+        return const_cast<EnemyPool*>(this)->get(handle);
+    }
+
+    EnemyHandle handleAt(size_t i) const {
+        uint32_t slot = denseSlots[i];
+        return { slot, slots[slot].generation, items[i].getType() };
+    }
+
+    template <typename Pred>
+    size_t removeIf(Pred pred) {
+        size_t removed = 0;
+        for (size_t i = 0; i < items.size();) {
+            if (!pred(items[i])) {
+                ++i;
+                continue;
+            }
+            eraseAt(i);
+            ++removed;
+        }
+        return removed;
+    }
+
+    void clear() {
+        for (uint32_t slot : denseSlots) {
+            slots[slot].generation++;
+            freeSlots.push_back(slot);
+        }
+        items.clear();
+        denseSlots.clear();
+    }
+
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+    T& operator[](size_t i) { return items[i]; }
+    const T& operator[](size_t i) const { return items[i]; }
+
+    typename std::vector<T>::iterator begin() { return items.begin(); }
+    typename std::vector<T>::iterator end() { return items.end(); }
+    typename std::vector<T>::const_iterator begin() const { return items.begin(); }
+    typename std::vector<T>::const_iterator end() const { return items.end(); }
+
+private:
+    struct Slot {
+        uint32_t generation = 0;
+        uint32_t dense = UINT32_MAX;
+    };
+
+    void eraseAt(size_t i) {
+        uint32_t slot = denseSlots[i];
+        slots[slot].generation++;
+        slots[slot].dense = UINT32_MAX;
+        freeSlots.push_back(slot);
+
+        size_t last = items.size() - 1;
+        if (i != last) {
+            items[i] = std::move(items[last]);
+            denseSlots[i] = denseSlots[last];
+            slots[denseSlots[i]].dense = static_cast<uint32_t>(i);
+        }
+        items.pop_back();
+        denseSlots.pop_back();
+    }
+
+    std::vector<T> items;
+    std::vector<uint32_t> denseSlots;  // owning slot of each item
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+};
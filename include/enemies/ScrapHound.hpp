@@ -4,7 +4,7 @@
 
 class Map;
 
-class ScrapHound : public Enemy {
+class ScrapHound final : public Enemy {
 public:
     ScrapHound(const ScrapHound&) = delete;
     ScrapHound& operator=(const ScrapHound&) = delete;
@@ -19,7 +19,6 @@ public:
     Rectangle getHitbox() const override;
     EnemyType getType() const override { return EnemyType::SCRAP_HOUND; }
     EnemySpawnConfig getSpawnConfig() const override;
-    void requestPathAsync(const Map& map, Vector2 start, Vector2 goal) override;
 
     Rectangle getArrowHitbox() const;
     bool canTakeDamage() const;
@@ -6,6 +6,8 @@
 #include <random>
 #include <mutex>
 #include <functional>
+#include <memory>
+#include "core/FastRNG.hpp"
 
 // Forward declaration
 class Player;
@@ -72,18 +74,6 @@ namespace MapConstants {
     int rollPercent(std::mt19937& gen);
 }
 
-struct TileParticle {
-    Vector2 position;
-    Vector2 velocity;
-    Color color;
-    float life;
-    float maxLife;
-    float size;
-    
-    TileParticle(Vector2 pos, Vector2 vel, Color col, float lifetime, float sz)
-        : position(pos), velocity(vel), color(col), life(lifetime), maxLife(lifetime), size(sz) {}
-};
-
 struct LavaCell {
     float mass;
     float flow;
@@ -128,6 +118,10 @@ class RoomGenerator;
 class RoomGridGenerator;
 class RoomConnectionGenerator;
 class LadderRopePlacer;
+class NavHierarchy;
+class NavGraph;
+class TileMask;
+class Raycaster;
 
 class Map {
     friend class RoomContentGenerator;
@@ -151,9 +145,8 @@ public:
     void applyConwayAutomata();
     void updateTransitions(float dt);
     void updateLavaFlow(float dt);
-    void updateParticles(float dt, Vector2 playerPosition = {0, 0});
-    void createPopEffect(Vector2 position);
-    void createSuctionEffect(Vector2 position);
+    void createPopEffect(Vector2 position, FastRNG& rng);
+    void createSuctionEffect(Vector2 position, FastRNG& rng);
     bool isLavaTile(int x, int y) const;
     bool checkPlayerLavaContact(Vector2 playerPos, float playerWidth, float playerHeight) const;
 
@@ -181,6 +174,15 @@ public:
     std::vector<Chunk> chunks;
 
     const std::vector<Room>& getGeneratedRooms() const;
+    // Built at the end of generation; null if the map failed to generate.
+    const NavHierarchy* getNavHierarchy() const { return navHierarchy.get(); }
+    const NavGraph* getNavGraph() const { return navGraph.get(); }
+    const TileMask* getTileMask() const { return tileMask.get(); }
+    const Raycaster* getRaycaster() const { return raycaster.get(); }
+    // Tile writers flag changed cells; repairNavGraph() patches the graph
+    // and tile mask around them once per tick.
+    void markNavDirty(int x, int y);
+    void repairNavGraph();
     
     // Player reference methods
     void setPlayer(Player* player) { playerRef = player; }
@@ -197,9 +199,14 @@ private:
     std::vector<std::vector<bool>> isOriginalSolid;
     std::vector<std::vector<bool>> isConwayProtected;
     std::vector<Texture2D> tileTextures;
+    // Drawn from only by the automata stages, in tick order, so automata
+    // evolution replays from the run seed.
+    FastRNG automataRng;
     std::vector<Room> generatedRooms;
-    std::vector<TileParticle> particles;
-    mutable std::mutex particlesMutex;
+    std::unique_ptr<NavHierarchy> navHierarchy;
+    std::unique_ptr<NavGraph> navGraph;
+    std::unique_ptr<TileMask> tileMask;
+    std::unique_ptr<Raycaster> raycaster;
 
     static constexpr float LAVA_FLOW_RATE = 0.8f;
     static constexpr float LAVA_MIN_FLOW = 0.01f;
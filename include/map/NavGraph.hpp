@@ -0,0 +1,113 @@
+#pragma once
+#include <raylib.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+class Map;
+
+enum class NavLink : uint8_t {
+    WALK,   // along a span or across a chunk border
+    JUMP,   // arc to a span within the jump limits
+    DROP,   // walk off a ledge and fall
+    CLIMB   // ladder or rope
+};
+
+// One point of a route: the tile to reach (FindPathAStar's world convention)
+// and how the previous point connects to it.
+struct NavWaypoint {
+    Vector2 position;
+    NavLink link;
+};
+
+// Platformer navigation graph. Nodes are spans: horizontal runs of standable
+// cells (not solid, not lava, solid below), cut at chunk borders so each
+// span belongs to one chunk. Edges are typed moves between spans.
+//
+// Tile writers call markDirty(); repair() then rebuilds the spans of dirty
+// chunks and the links of every span within one chunk of them. No link
+// reaches further than CHUNK_SIZE cells (drops and climbs are capped), so it
+// never leaves the neighbouring chunks and nothing else can be affected.
+//
+// Searches take a shared lock and repair() an exclusive one, so path
+// workers can keep querying while the simulation edits tiles.
+class NavGraph {
+public:
+    static constexpr int CHUNK_SIZE = 16;
+    static constexpr int MAX_JUMP_UP = 3;
+    static constexpr int MAX_JUMP_DOWN = 4;
+    static constexpr int MAX_JUMP_ACROSS = 4;
+    static constexpr int MAX_DROP = CHUNK_SIZE;
+    static constexpr int MAX_CLIMB = CHUNK_SIZE;
+
+    void build(const Map& map);
+    // A change at (x, y) can also make (x, y - 1) (un)standable. Safe to
+    // call from parallel tile writers.
+    void markDirty(int x, int y);
+    // Returns the number of chunks whose spans were rebuilt.
+    int repair(const Map& map);
+
+    size_t getSpanCount() const;
+    // Returns false when start or goal is not on (or just above) a span, or
+    // no route exists. expansions (optional) counts spans expanded;
+    // revision (optional) receives the graph revision that was searched.
+    bool findPath(Vector2 start, Vector2 goal, std::vector<NavWaypoint>& outPath, int* expansions = nullptr, uint64_t* revision = nullptr) const;
+
+    // Every repair() bumps the revision and stamps the chunks it relinked,
+    // so a route found at revision R is still valid while none of the
+    // chunks it passes through has a stamp newer than R.
+    int chunkAt(Vector2 position) const;
+    // The span findPath would start or end on for position, or -1. cellX and
+    // cellY (optional) receive the cell on it closest to position. Span ids
+    // are reused after a repair, so callers holding one must also check the
+    // chunk it lies in with isChunkUnchangedSince().
+    int32_t spanUnder(Vector2 position, int* cellX = nullptr, int* cellY = nullptr) const;
+    bool isChunkUnchangedSince(int chunk, uint64_t revision) const;
+
+private:
+    struct Edge {
+        int32_t to;
+        float cost;
+        NavLink link;
+        int16_t exitX;  // cell on this span where the move starts
+        int16_t landX;  // cell on the target span where it ends
+    };
+
+    struct Span {
+        int16_t x0, x1, y;
+        int32_t chunk;
+        bool alive = false;
+        std::vector<Edge> edges;
+    };
+
+    int chunkOf(int x, int y) const { return (x / CHUNK_SIZE) * chunksHigh + (y / CHUNK_SIZE); }
+    int32_t spanAtCell(int x, int y) const;
+    int32_t locate(Vector2 position) const;
+
+    void rebuildChunkSpans(const Map& map, int chunk);
+    void rebuildLinks(const Map& map, int32_t span);
+    void addEdge(Span& from, int32_t to, float cost, NavLink link, int exitX, int landX);
+    void linkJumps(const Map& map, int32_t index);
+    void linkDrop(const Map& map, int32_t index, int x);
+    void linkClimbs(const Map& map, int32_t index);
+
+    int width = 0;
+    int height = 0;
+    int chunksWide = 0;
+    int chunksHigh = 0;
+    size_t liveSpans = 0;
+    std::vector<Span> spans;
+    std::vector<int32_t> freeSpans;
+    std::vector<std::vector<int32_t>> chunkSpans;
+    std::vector<int32_t> spanAt;  // per cell, -1 when not standable
+
+    std::unique_ptr<std::atomic<uint8_t>[]> dirtyChunks;
+    std::atomic<bool> anyDirty{false};
+    std::vector<uint8_t> relinkScratch;
+    uint64_t revision = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> chunkRevision;
+    mutable std::shared_mutex mutex;
+};
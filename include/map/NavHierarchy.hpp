@@ -0,0 +1,63 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Map;
+
+// Abstract graph for hierarchical pathfinding (HPA*). The map is cut into
+// CLUSTER_SIZE square clusters (the same grid as Map::chunks). Each run of
+// walkable cells crossing a cluster border becomes an entrance with a node
+// on either side; nodes in one cluster are linked by their in-cluster walking
+// distance. Walkability follows FindPathAStar: an empty tile with solid
+// ground below, 4-connected.
+//
+// A query searches only the start and goal clusters at tile level, runs A*
+// over the few hundred entrance nodes in between, and refines just the
+// first leg. Built once at generation; tiles that change afterwards are seen
+// by the refinement but not by the abstract edges. Queries read walkability
+// from Map::getTileMask(), never the tiles themselves, so they are safe on
+// path workers while the simulation edits the map.
+class NavHierarchy {
+public:
+    static constexpr int CLUSTER_SIZE = 16;
+
+    void build(const Map& map);
+    bool isBuilt() const { return !nodes.empty(); }
+    size_t getNodeCount() const { return nodes.size(); }
+
+    // outPath receives the tile route to the first entrance, then the
+    // remaining entrances, then the goal, all in FindPathAStar's world
+    // convention. Returns false when start and goal share a cluster or no
+    // route exists on the abstract graph; callers fall back to the flat search.
+    // expansions (optional) counts tile and abstract node expansions.
+    bool findPath(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, int* expansions = nullptr) const;
+
+private:
+    struct Node {
+        int32_t x, y;
+        int32_t cluster;
+        int32_t firstEdge;
+        int32_t edgeCount;
+    };
+
+    struct Edge {
+        int32_t to;
+        float cost;
+    };
+
+    int clusterOf(int x, int y) const { return (x / CLUSTER_SIZE) * clustersHigh + (y / CLUSTER_SIZE); }
+
+    void addTransition(int ax, int ay, int bx, int by, std::vector<std::vector<Edge>>& adjacency);
+    int32_t nodeAt(int x, int y, std::vector<std::vector<Edge>>& adjacency);
+
+    int width = 0;
+    int height = 0;
+    int clustersWide = 0;
+    int clustersHigh = 0;
+    std::vector<Node> nodes;
+    std::vector<Edge> edges;                        // grouped by node, see Node::firstEdge
+    std::vector<std::vector<int32_t>> clusterNodes; // node ids per cluster
+    std::vector<int32_t> nodeIndex;                 // per cell, -1 when not an entrance
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+
+class TileMask;
+
+enum class RayBlocker : uint8_t {
+    SOLID,   // Map::isSolidTile; projectiles
+    OPAQUE   // solid except platforms; line of sight
+};
+
+struct RaySegment {
+    Vector2 from;
+    Vector2 to;
+};
+
+struct RayHit {
+    bool hit = false;
+    Vector2 point = { 0.0f, 0.0f };   // where the segment enters the blocking tile
+    float distance = 0.0f;            // from the segment start, in world units
+    Vector2 normal = { 0.0f, 0.0f };  // face that was entered; zero when starting inside
+    int tileX = 0;
+    int tileY = 0;
+};
+
+// Segment casts against the map's TileMask with an Amanatides-Woo DDA: the
+// ray visits exactly the tiles it crosses, in order, one step per tile.
+// Safe to call from any thread; the mask is only patched in the navgraph
+// task, which no tile reader overlaps.
+class Raycaster {
+public:
+    static constexpr float TILE_SIZE = 32.0f;
+
+    explicit Raycaster(const TileMask& mask);
+
+    bool raycast(Vector2 from, Vector2 to, RayHit& hit, RayBlocker blocker = RayBlocker::SOLID) const;
+    // One RayHit per segment. Large batches are split across the JobSystem.
+    void raycastBatch(const RaySegment* segments, size_t count, RayHit* hits, RayBlocker blocker = RayBlocker::SOLID) const;
+
+private:
+    bool isBlocked(int x, int y, RayBlocker blocker) const;
+
+    const TileMask& mask;
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class Map;
+
+// Per-cell tile predicates packed as bitmaps for grid queries:
+//  - walkable, FindPathAStar's rule (an empty tile with solid ground below),
+//    kept both row-major (bit x of row y) and column-major (bit y of
+//    column x) so grid searches can scan either axis 64 cells per load;
+//  - solid, as Map::isSolidTile;
+//  - opaque, solid tiles other than platforms, which sight passes through.
+// Out-of-range cells read as unwalkable, solid and opaque.
+//
+// Kept current the same way as NavGraph: tile writers mark cells dirty and
+// repair() recomputes the dirty chunks once per tick. Words are atomic, so
+// path workers may read while repair() writes.
+class TileMask {
+public:
+    static constexpr int CHUNK_SIZE = 16;
+
+    void build(const Map& map);
+    void markDirty(int x, int y);
+    void repair(const Map& map);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getRowWords() const { return rowWords; }
+    int getColumnWords() const { return columnWords; }
+
+    bool isWalkable(int x, int y) const {
+        if (x < 0 || y < 0 || x >= width || y >= height) return false;
+        return (rowWord(y, x >> 6) >> (x & 63)) & 1u;
+    }
+    bool isSolid(int x, int y) const { return testBit(solidRows.get(), x, y); }
+    bool isOpaque(int x, int y) const { return testBit(opaqueRows.get(), x, y); }
+
+    uint64_t rowWord(int y, int word) const {
+        if (y < 0 || y >= height || word < 0 || word >= rowWords) return 0;
+        return rows[static_cast<size_t>(y) * rowWords + word].load(std::memory_order_relaxed);
+    }
+    uint64_t columnWord(int x, int word) const {
+        if (x < 0 || x >= width || word < 0 || word >= columnWords) return 0;
+        return columns[static_cast<size_t>(x) * columnWords + word].load(std::memory_order_relaxed);
+    }
+
+private:
+    bool testBit(const std::atomic<uint64_t>* bits, int x, int y) const {
+        if (x < 0 || y < 0 || x >= width || y >= height) return true;
+        return (bits[static_cast<size_t>(y) * rowWords + (x >> 6)].load(std::memory_order_relaxed) >> (x & 63)) & 1u;
+    }
+    void refreshCell(const Map& map, int x, int y);
+
+    int width = 0;
+    int height = 0;
+    int rowWords = 0;
+    int columnWords = 0;
+    int chunksHigh = 0;
+    size_t chunkCount = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> rows;
+    std::unique_ptr<std::atomic<uint64_t>[]> columns;
+    std::unique_ptr<std::atomic<uint64_t>[]> solidRows;
+    std::unique_ptr<std::atomic<uint64_t>[]> opaqueRows;
+    std::unique_ptr<std::atomic<uint8_t>[]> dirtyChunks;
+    std::atomic<bool> anyDirty{false};
+};
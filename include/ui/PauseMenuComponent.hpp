@@ -3,7 +3,6 @@
 #include "ui/UIController.hpp"
 #include <raylib.h>
 #include <atomic>
-#include <thread>
 #include <vector>
 
 namespace UI {
@@ -35,12 +34,11 @@ namespace UI {
             std::atomic<bool> ready{false};
         };
         
-        void updateBackgroundAnimations();
+        void updateBackgroundAnimations(float dt);
         
         BackgroundData bgData[2];
         int currentBgBuffer = 0;
-        std::thread bgAnimThread;
-        std::atomic<bool> threadRunning{true};
+        float bgAnimTime = 0.0f;
         
         float titleAnimTime = 0.0f;
         float buttonAnimTime = 0.0f;
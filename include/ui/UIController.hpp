@@ -4,9 +4,6 @@
 #include <raylib.h>
 #include <memory>
 #include <atomic>
-#include <thread>
-#include <mutex>
-#include <condition_variable>
 #include <unordered_map>
 #include <vector>
 
@@ -70,7 +67,6 @@ namespace UI {
     private:
         void initializeComponents();
         void updateAnimations();
-        void handleBackgroundThread();
         
         int screenWidth, screenHeight;
         std::unordered_map<ComponentType, std::unique_ptr<UIComponent>> components;
@@ -78,15 +74,9 @@ namespace UI {
         
         float lastDeltaTime = 0.0f; // Store deltaTime for use in draw method
         
-        std::thread backgroundThread;
-        std::atomic<bool> threadRunning{true};
-        std::mutex dataMutex;
-        std::condition_variable dataCondition;
-        
         UIDrawData drawData[2];
         int currentBuffer = 0;
         
         float globalAnimTime = 0.0f;
-        std::atomic<bool> needsUpdate{false};
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <raylib.h>
+#include <cstdint>
 #include <string>
 
 class ScrapHound;
@@ -23,6 +24,8 @@ public:
     virtual void draw(Vector2 playerPosition, bool facingRight) const;
     virtual Rectangle getHitbox(Vector2 playerPosition, bool facingRight) const;
     bool isAttacking() const { return attacking; }
+    // Changes whenever a new swing starts; unique across weapons.
+    uint32_t getSwingId() const { return swingId; }
     std::string getName() const { return name; }
     WeaponType getType() const { return type; }
     float getDamage() const { return baseDamage * damageMultiplier; }
@@ -32,6 +35,8 @@ public:
     virtual void levelUp();
     virtual Vector2 getKnockback(bool facingRight) const;
 protected:
+    void beginSwing() { swingId = nextSwingId++; }
+
     std::string name;
     WeaponType type;
     float baseDamage;
@@ -45,4 +50,7 @@ protected:
     Texture2D texture;
     int currentFrame = 0;
     float frameTime = 0.0f;
+    uint32_t swingId = 0;
+private:
+    static uint32_t nextSwingId;
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Camera.hpp"
 #include "map/Map.hpp"
+#include "core/RngService.hpp"
 #include <raylib.h>
 #include <raymath.h>
 #include <cmath>
@@ -45,8 +46,9 @@ void GameCamera::updateScreenshake(float deltaTime) {
         float normalizedTime = shakeTimer / shakeDuration;
         float currentIntensity = shakeIntensity * normalizedTime;
 
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        float magnitude = currentIntensity * GetRandomValue(50, 100) / 100.0f;
+        FastRNG& rng = RngService::getInstance().local(RngStream::CAMERA);
+        float angle = rng.nextFloat(0.0f, 360.0f) * DEG2RAD;
+        float magnitude = currentIntensity * rng.nextFloat(0.5f, 1.0f);
         
         shakeOffset.x = cosf(angle) * magnitude * 0.01f; 
         shakeOffset.y = sinf(angle) * magnitude * 0.01f;
@@ -0,0 +1,170 @@
+#include "CollisionGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+bool SegmentEntersRect(Vector2 from, Vector2 to, const Rectangle& box, float& tEnter) {
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    const float origin[2] = { from.x, from.y };
+    const float dir[2] = { to.x - from.x, to.y - from.y };
+    const float lo[2] = { box.x, box.y };
+    const float hi[2] = { box.x + box.width, box.y + box.height };
+    for (int axis = 0; axis < 2; ++axis) {
+        if (dir[axis] == 0.0f) {
+            if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) return false;
+            continue;
+        }
+        float t0 = (lo[axis] - origin[axis]) / dir[axis];
+        float t1 = (hi[axis] - origin[axis]) / dir[axis];
+        if (t0 > t1) std::swap(t0, t1);
+        tMin = std::max(tMin, t0);
+        tMax = std::min(tMax, t1);
+        if (tMin > tMax) return false;
+    }
+    tEnter = tMin;
+    return true;
+}
+
+CollisionGrid& CollisionGrid::getInstance() {
+    static CollisionGrid instance;
+    return instance;
+}
+
+CollisionGrid::CollisionGrid() : bucketStart(BUCKET_COUNT + 1, 0) {}
+
+int CollisionGrid::cellOf(float world) {
+    return static_cast<int>(std::floor(world / CELL_SIZE));
+}
+
+size_t CollisionGrid::bucketOf(int cellX, int cellY) {
+    uint32_t hash = static_cast<uint32_t>(cellX) * 73856093u ^ static_cast<uint32_t>(cellY) * 19349663u;
+    return hash & (BUCKET_COUNT - 1);
+}
+
+bool CollisionGrid::overlaps(const Rectangle& a, const Rectangle& b) {
+    return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+           a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+// Both boxes cover the cell of the corner where their overlap starts, so
+// exactly one of the cells they share reports the pair.
+bool CollisionGrid::isReferenceCell(const Rectangle& a, const Rectangle& b, int cellX, int cellY) {
+    return cellOf(std::max(a.x, b.x)) == cellX && cellOf(std::max(a.y, b.y)) == cellY;
+}
+
+void CollisionGrid::clear() {
+    colliders.clear();
+    pending.clear();
+    entries.clear();
+    std::fill(bucketStart.begin(), bucketStart.end(), 0);
+}
+
+ColliderId CollisionGrid::add(Rectangle bounds, ColliderKind kind, EnemyHandle enemy) {
+    bounds.x -= MARGIN;
+    bounds.y -= MARGIN;
+    bounds.width += 2.0f * MARGIN;
+    bounds.height += 2.0f * MARGIN;
+
+    ColliderId id = static_cast<ColliderId>(colliders.size());
+    colliders.push_back({ bounds, kind, enemy });
+
+    uint32_t kindBit = 1u << static_cast<uint32_t>(kind);
+    int x1 = cellOf(bounds.x + bounds.width);
+    int y1 = cellOf(bounds.y + bounds.height);
+    for (int x = cellOf(bounds.x); x <= x1; ++x) {
+        for (int y = cellOf(bounds.y); y <= y1; ++y) {
+            pending.push_back({ x, y, id, kindBit });
+        }
+    }
+    return id;
+}
+
+void CollisionGrid::build() {
+    std::fill(bucketStart.begin(), bucketStart.end(), 0);
+    for (const Entry& entry : pending) {
+        ++bucketStart[bucketOf(entry.cellX, entry.cellY) + 1];
+    }
+    for (size_t i = 1; i <= BUCKET_COUNT; ++i) {
+        bucketStart[i] += bucketStart[i - 1];
+    }
+
+    entries.resize(pending.size());
+    cursor.assign(bucketStart.begin(), bucketStart.end() - 1);
+    for (const Entry& entry : pending) {
+        entries[cursor[bucketOf(entry.cellX, entry.cellY)]++] = entry;
+    }
+}
+
+void CollisionGrid::queryRect(Rectangle area, uint32_t mask, std::vector<ColliderId>& out) const {
+    int x1 = cellOf(area.x + area.width);
+    int y1 = cellOf(area.y + area.height);
+    for (int x = cellOf(area.x); x <= x1; ++x) {
+        for (int y = cellOf(area.y); y <= y1; ++y) {
+            forEachEntryInCell(x, y, mask, [&](ColliderId id) {
+                const Rectangle& bounds = colliders[id].bounds;
+                if (overlaps(area, bounds) && isReferenceCell(area, bounds, x, y)) {
+                    out.push_back(id);
+                }
+            });
+        }
+    }
+}
+
+void CollisionGrid::queryCircle(Vector2 center, float radius, uint32_t mask, std::vector<ColliderId>& out) const {
+    size_t first = out.size();
+    queryRect({ center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f }, mask, out);
+    out.erase(std::remove_if(out.begin() + first, out.end(), [&](ColliderId id) {
+        const Rectangle& bounds = colliders[id].bounds;
+        float dx = center.x - std::clamp(center.x, bounds.x, bounds.x + bounds.width);
+        float dy = center.y - std::clamp(center.y, bounds.y, bounds.y + bounds.height);
+        return dx * dx + dy * dy > radius * radius;
+    }), out.end());
+}
+
+void CollisionGrid::querySegment(Vector2 from, Vector2 to, uint32_t mask, std::vector<ColliderId>& out) const {
+    thread_local std::vector<std::pair<float, ColliderId>> hits;
+    hits.clear();
+
+    Vector2 delta = { to.x - from.x, to.y - from.y };
+    auto visit = [&](int x, int y) {
+        forEachEntryInCell(x, y, mask, [&](ColliderId id) {
+            float t;
+            if (SegmentEntersRect(from, to, colliders[id].bounds, t)) {
+                hits.push_back({ t, id });
+            }
+        });
+    };
+
+    // Amanatides-Woo walk over the cells the segment passes through.
+    int x = cellOf(from.x);
+    int y = cellOf(from.y);
+    int endX = cellOf(to.x);
+    int endY = cellOf(to.y);
+    int stepX = delta.x > 0.0f ? 1 : -1;
+    int stepY = delta.y > 0.0f ? 1 : -1;
+    float tDeltaX = delta.x != 0.0f ? std::fabs(CELL_SIZE / delta.x) : INFINITY;
+    float tDeltaY = delta.y != 0.0f ? std::fabs(CELL_SIZE / delta.y) : INFINITY;
+    float tMaxX = delta.x != 0.0f ? ((stepX > 0 ? (x + 1) * CELL_SIZE : x * CELL_SIZE) - from.x) / delta.x : INFINITY;
+    float tMaxY = delta.y != 0.0f ? ((stepY > 0 ? (y + 1) * CELL_SIZE : y * CELL_SIZE) - from.y) / delta.y : INFINITY;
+
+    visit(x, y);
+    int remaining = std::abs(endX - x) + std::abs(endY - y);
+    while (remaining-- > 0) {
+        if (tMaxX < tMaxY) {
+            x += stepX;
+            tMaxX += tDeltaX;
+        } else {
+            y += stepY;
+            tMaxY += tDeltaY;
+        }
+        visit(x, y);
+    }
+
+    // A box spanning several cells is met once per cell.
+    std::sort(hits.begin(), hits.end());
+    hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+    for (const auto& hit : hits) {
+        out.push_back(hit.second);
+    }
+}
@@ -0,0 +1,142 @@
+#include "CombatResolver.hpp"
+#include "Player.hpp"
+#include "Camera.hpp"
+#include "enemies/EnemyManager.hpp"
+#include "effects/ParticleSystem.hpp"
+#include "core/EventManager.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <tuple>
+
+namespace {
+    // The player sorts ahead of every enemy.
+    auto TargetKey(const EnemyHandle& target) {
+        return std::make_tuple(target.isValid(), static_cast<int>(target.type), target.index, target.generation);
+    }
+
+    bool SameTarget(const EnemyHandle& a, const EnemyHandle& b) {
+        return TargetKey(a) == TargetKey(b);
+    }
+
+    const char* EnemyTypeName(EnemyType type) {
+        switch (type) {
+            case EnemyType::SCRAP_HOUND: return "ScrapHound";
+            case EnemyType::AUTOMATON: return "Automaton";
+            case EnemyType::DETONODE: return "Detonode";
+        }
+        return "Enemy";
+    }
+}
+
+CombatResolver& CombatResolver::getInstance() {
+    static CombatResolver instance;
+    return instance;
+}
+
+void CombatResolver::submit(const HitCandidate& hit) {
+    candidates.push_back(hit);
+    ++stats.submitted;
+}
+
+void CombatResolver::clear() {
+    candidates.clear();
+    currentSwing = 0;
+    swingVictims.clear();
+}
+
+void CombatResolver::resolve(EnemyManager& enemyManager, Player& player, GameCamera& camera) {
+    if (candidates.empty()) return;
+
+    std::stable_sort(candidates.begin(), candidates.end(), [](const HitCandidate& a, const HitCandidate& b) {
+        return std::make_tuple(TargetKey(a.target), a.source) < std::make_tuple(TargetKey(b.target), b.source);
+    });
+
+    ParticleSystem& particles = ParticleSystem::getInstance();
+    float oldHealth = player.getHealth();
+    thread_local std::vector<Core::EnemyDefeatedEvent> defeated;
+    defeated.clear();
+
+    bool targetHit = false;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        const HitCandidate& hit = candidates[i];
+        if (i == 0 || !SameTarget(hit.target, candidates[i - 1].target)) {
+            targetHit = false;
+        }
+
+        if (hit.source == HitSource::WEAPON && hit.sourceId != currentSwing) {
+            currentSwing = hit.sourceId;
+            swingVictims.clear();
+        }
+        bool swingRepeat = hit.source == HitSource::WEAPON &&
+            std::any_of(swingVictims.begin(), swingVictims.end(), [&](const EnemyHandle& victim) {
+                return SameTarget(victim, hit.target);
+            });
+        if (targetHit || swingRepeat) {
+            ++stats.blocked;
+            continue;
+        }
+
+        if (!hit.target.isValid()) {
+            if (!player.canTakeDamage()) {
+                ++stats.blocked;
+                continue;
+            }
+            player.takeDamage(hit.damage);
+            if (hit.knockback.x != 0.0f || hit.knockback.y != 0.0f) {
+                player.applyKnockback(hit.knockback);
+            }
+        } else {
+            Enemy* enemy = enemyManager.getEnemy(hit.target);
+            if (!enemy || !enemy->isAlive() || !enemy->canTakeDamage()) {
+                ++stats.blocked;
+                continue;
+            }
+            enemy->takeDamage(hit.damage);
+            if (hit.knockback.x != 0.0f || hit.knockback.y != 0.0f) {
+                enemy->applyKnockback(hit.knockback);
+            }
+            if (hit.source == HitSource::WEAPON) {
+                swingVictims.push_back(hit.target);
+            }
+            if (!enemy->isAlive()) {
+                Core::EnemyDefeatedEvent event;
+                event.enemyType = EnemyTypeName(enemy->getType());
+                event.positionX = enemy->getPosition().x;
+                event.positionY = enemy->getPosition().y;
+                event.scoreValue = static_cast<int>(enemy->getMaxHealth());
+                defeated.push_back(event);
+            }
+        }
+
+        targetHit = true;
+        ++stats.landed;
+        if (hit.shakeIntensity > 0.0f) {
+            camera.addScreenshake(hit.shakeIntensity, hit.shakeDuration);
+        }
+        if (hit.particleCount > 0) {
+            particles.createExplosionParticles(hit.impact, hit.particleCount, hit.particleColor);
+        }
+    }
+    candidates.clear();
+
+    auto& eventManager = Core::GetEventManager();
+    if (player.getHealth() != oldHealth) {
+        Core::PlayerHealthChangedEvent event;
+        event.oldHealth = static_cast<int>(oldHealth);
+        event.newHealth = static_cast<int>(player.getHealth());
+        event.maxHealth = static_cast<int>(player.getMaxHealth());
+        eventManager.queueEvent(event);
+    }
+    for (const auto& event : defeated) {
+        eventManager.queueEvent(event);
+    }
+    stats.defeated += defeated.size();
+}
+
+void CombatResolver::dumpStats() const {
+    printf("[CombatResolver] %llu candidates, %llu landed, %llu blocked, %llu enemies defeated\n",
+           static_cast<unsigned long long>(stats.submitted),
+           static_cast<unsigned long long>(stats.landed),
+           static_cast<unsigned long long>(stats.blocked),
+           static_cast<unsigned long long>(stats.defeated));
+}
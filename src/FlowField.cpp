@@ -0,0 +1,145 @@
+#include "FlowField.hpp"
+#include "map/Map.hpp"
+#include <algorithm>
+
+namespace {
+    bool IsWalkable(const Map& map, int x, int y) {
+        return map.isTileEmpty(x, y) && map.isSolidTile(x, y + 1);
+    }
+
+    int ToTileX(float worldX) { return (int)((worldX + 16) / 32); }
+    int ToTileY(float worldY) { return (int)((worldY + 32) / 32); }
+}
+
+FlowField& FlowField::getInstance() {
+    static FlowField instance;
+    return instance;
+}
+
+FlowField::FlowField() {
+    front.distance.assign(SIDE * SIDE, UNREACHED);
+    back.distance.assign(SIDE * SIDE, UNREACHED);
+    frontier.reserve(SIDE * SIDE);
+}
+
+int FlowField::Field::at(int x, int y) const {
+    int lx = x - originX;
+    int ly = y - originY;
+    if (!valid || lx < 0 || ly < 0 || lx >= SIDE || ly >= SIDE) return -1;
+    uint16_t d = distance[lx * SIDE + ly];
+    return d == UNREACHED ? -1 : d;
+}
+
+void FlowField::setMap(const Map* newMap) {
+    map = newMap;
+    front.valid = false;
+    back.valid = false;
+    rebuilding = false;
+    ticksSinceRebuild = 0;
+}
+
+void FlowField::update(Vector2 target) {
+    if (!map) return;
+
+    int tx = ToTileX(target.x);
+    int ty = ToTileY(target.y);
+    ++ticksSinceRebuild;
+
+    if (!rebuilding && ticksSinceRebuild >= REBUILD_INTERVAL) {
+        bool moved = !front.valid || tx != front.targetX || ty != front.targetY;
+        if (moved || ticksSinceRebuild >= REFRESH_TICKS) {
+            beginRebuild(tx, ty);
+        }
+    }
+
+    if (rebuilding && expand(EXPANSION_BUDGET)) {
+        std::swap(front, back);
+        front.valid = true;
+        rebuilding = false;
+    }
+}
+
+void FlowField::beginRebuild(int targetX, int targetY) {
+    back.originX = targetX - RADIUS;
+    back.originY = targetY - RADIUS;
+    back.targetX = targetX;
+    back.targetY = targetY;
+    back.valid = false;
+    std::fill(back.distance.begin(), back.distance.end(), UNREACHED);
+
+    frontier.clear();
+    frontierHead = 0;
+    if (map->isInsideBounds(targetX, targetY)) {
+        int32_t seed = RADIUS * SIDE + RADIUS;
+        back.distance[seed] = 0;
+        frontier.push_back(seed);
+    }
+    rebuilding = true;
+    ticksSinceRebuild = 0;
+}
+
+bool FlowField::expand(int budget) {
+    const int dirs[4][2] = { {1,0}, {-1,0}, {0,1}, {0,-1} };
+    int width = map->getWidth();
+    int height = map->getHeight();
+
+    // Unit edge costs, so a FIFO frontier settles cells in distance order.
+    while (frontierHead < frontier.size() && budget-- > 0) {
+        int32_t current = frontier[frontierHead++];
+        int lx = current / SIDE;
+        int ly = current % SIDE;
+        uint16_t next = back.distance[current] + 1;
+
+        for (const auto& d : dirs) {
+            int nlx = lx + d[0];
+            int nly = ly + d[1];
+            if (nlx < 0 || nly < 0 || nlx >= SIDE || nly >= SIDE) continue;
+
+            int32_t neighbor = nlx * SIDE + nly;
+            if (back.distance[neighbor] != UNREACHED) continue;
+
+            int x = back.originX + nlx;
+            int y = back.originY + nly;
+            if (x < 0 || y < 0 || x >= width || y >= height) continue;
+            if (!IsWalkable(*map, x, y)) continue;
+
+            back.distance[neighbor] = next;
+            frontier.push_back(neighbor);
+        }
+    }
+    return frontierHead >= frontier.size();
+}
+
+bool FlowField::nextStep(Vector2 position, Vector2& outStep) const {
+    int x = ToTileX(position.x);
+    int y = ToTileY(position.y);
+
+    int best = front.at(x, y);
+    if (best == 0) {
+        outStep = Vector2{ x * 32.0f, y * 32.0f };
+        return true;
+    }
+
+    // Off-field cells (mid-jump, knocked into a wall) count as infinitely
+    // far, so any reachable neighbour is an improvement.
+    const int dirs[4][2] = { {1,0}, {-1,0}, {0,1}, {0,-1} };
+    int bestX = 0;
+    int bestY = 0;
+    bool found = false;
+    for (const auto& d : dirs) {
+        int n = front.at(x + d[0], y + d[1]);
+        if (n < 0 || (best >= 0 && n >= best)) continue;
+        best = n;
+        bestX = x + d[0];
+        bestY = y + d[1];
+        found = true;
+    }
+    if (!found) return false;
+
+    outStep = Vector2{ bestX * 32.0f, bestY * 32.0f };
+    return true;
+}
+
+int FlowField::distanceAt(Vector2 position) const {
+    return front.at(ToTileX(position.x), ToTileY(position.y));
+}
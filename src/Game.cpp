@@ -1,9 +1,10 @@
 #include "Game.hpp"
+#include "effects/ParticleSystem.hpp"
 #include "raylib.h"
 #include "ui/UIController.hpp"
 #include "core/Core.hpp"
-#include "core/GlobalThreadPool.hpp"
-#include "effects/ParticleThreadPool.hpp"
+#include "core/JobSystem.hpp"
+#include "PathfindingService.hpp"
 
 const int screenWidth = 1920;
 const int screenHeight = 1080;
@@ -19,6 +20,9 @@ Game::Game()
     InitWindow(screenWidth, screenHeight, "Cellular Automata");
     SetExitKey(KEY_F4);
 
+    // Bring the workers up here so the main thread is recorded as the raylib thread.
+    JobSystem::getInstance().setStatsDumpInterval(60.0f);
+
     gameLoop = std::make_unique<Core::GameLoop>(60, 60);
     gameLoop->setUpdateCallback([this](float deltaTime) { update(deltaTime); });
     gameLoop->setRenderCallback([this](float interpolation) { render(interpolation); });
@@ -36,6 +40,7 @@ Game::Game()
     }
 
     initializeResources();
+    buildSimulationGraph();
     
     currentState = GameState::TITLE;
     uiController = std::make_unique<UI::UIController>(screenWidth, screenHeight);
@@ -58,22 +63,18 @@ Game::Game()
 }
 
 Game::~Game() {
-    mapGenerationInProgress.store(false, std::memory_order_release);
-    mapGenerationComplete.store(true, std::memory_order_release);
-    
-    if (mapGenerationFuture.valid()) {
-        try {
-            mapGenerationFuture.wait();
-        } catch (...) {
-        }
+    cancelMapGeneration();
+    if (tilePreloadJob) {
+        tilePreloadJob->cancel();
     }
+    PathfindingService::getInstance().setMap(nullptr);
+    
+    JobSystem::getInstance().shutdown();
     
     camera.reset();
     player.reset();
     map.reset();
-    
-    GlobalThreadPool::getInstance().shutdown();
-    ParticleThreadPool::getInstance().shutdown();
+    ParticleSystem::getInstance().unloadRenderResources();
     
     if (Core::IsInitialized()) {
         try {
@@ -1,6 +1,7 @@
 #include "Game.hpp"
 #include "raylib.h"
 #include "effects/ParticleSystem.hpp"
+#include "ProjectileSystem.hpp"
 #include "core/Core.hpp"
 
 void Game::render(float interpolation) {
@@ -56,7 +57,7 @@ void Game::render(float interpolation) {
     }
     
     if (currentState == GameState::PLAYING || currentState == GameState::PAUSED) {
-        if (mapGenerationInProgress || !map || !player || !camera) {
+        if (!map || !player || !camera) {
             BeginDrawing();
             ClearBackground(BLACK);
             if (uiController) {
@@ -73,11 +74,12 @@ void Game::render(float interpolation) {
         DrawTexture(fisheyeBackground, 0, 0, WHITE);
         BeginMode2D(camera->getCamera());
         map->draw(camera->getCamera());
+        ParticleSystem::getInstance().draw(camera->getCamera(), ParticleLayer::BEHIND_ACTORS);
         
 
         
         player->draw();
-        ParticleSystem::getInstance().draw();
+        ParticleSystem::getInstance().draw(camera->getCamera(), ParticleLayer::IN_FRONT);
 
         Vector2 topLeftWorld = GetScreenToWorld2D({0.0f, 0.0f}, camera->getCamera());
         Vector2 bottomRightWorld = GetScreenToWorld2D({(float)screenWidth, (float)screenHeight}, camera->getCamera());
@@ -90,15 +92,16 @@ void Game::render(float interpolation) {
         };
 
         enemyManager.drawEnemies();
+        ProjectileSystem::getInstance().draw();
         
         if (inputManager.isActionHeld(Core::InputAction::DEBUG_TOGGLE)) {
-            auto allEnemies = enemyManager.getAllEnemies();
-            for (auto* enemy : allEnemies) {
-                Rectangle enemyRect = enemy->getHitbox();
+            for (Enemy& enemy : enemyManager.getAllEnemies()) {
+                if (!enemy.isAlive()) continue;
+                Rectangle enemyRect = enemy.getHitbox();
                 Color debugColor = RED;
-                if (enemy->getType() == EnemyType::AUTOMATON) {
+                if (enemy.getType() == EnemyType::AUTOMATON) {
                     debugColor = BLUE;
-                } else if (enemy->getType() == EnemyType::DETONODE) {
+                } else if (enemy.getType() == EnemyType::DETONODE) {
                     debugColor = YELLOW;
                 }
                 DrawRectangleLines((int)enemyRect.x, (int)enemyRect.y, (int)enemyRect.width, (int)enemyRect.height, debugColor);
@@ -29,17 +29,10 @@ void Game::initializeResources() {
         numTiles++;
     }
     
-    resourceManager.preloadBatch(tilePaths);
-    
-    tileTextureHandles.clear();
-    tileTextures.clear();
-    for (const auto& path : tilePaths) {
-        auto handle = resourceManager.getTexture(path);
-        if (handle.isValid()) {
-            tileTextureHandles.push_back(handle);
-            tileTextures.push_back(*handle.get());
-        }
-    }
+    // Tiles stream in while the title screen is up; map generation awaits
+    // this job before it needs them.
+    tilePreloadJob = std::make_shared<Core::ResourcePreloadJob>(std::move(tilePaths));
+    LongJob::start(tilePreloadJob);
 
     sceneTexture = LoadRenderTexture(screenWidth, screenHeight);
     
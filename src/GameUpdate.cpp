@@ -1,8 +1,18 @@
 #include "Game.hpp"
 #include "core/Core.hpp"
+#include "core/JobSystem.hpp"
+#include "Pathfinding.hpp"
+#include "PathfindingService.hpp"
+#include "FlowField.hpp"
+#include "PlayerVisibility.hpp"
+#include "CollisionGrid.hpp"
+#include "ProjectileSystem.hpp"
+#include "CombatResolver.hpp"
+#include "core/TaskGraph.hpp"
 #include "effects/ParticleSystem.hpp"
 #include "ui/LoadingScreenComponent.hpp"
 #include "enemies/Automaton.hpp"
+#include <algorithm>
 
 
 void Game::update(float deltaTime) {
@@ -29,6 +39,7 @@ void Game::update(float deltaTime) {
     
     inputManager.update(deltaTime);
     eventManager.processEvents();
+    JobSystem::getInstance().processMainThreadJobs();
     
     resourceManager.checkForHotReload();
     
@@ -42,57 +53,14 @@ void Game::update(float deltaTime) {
     }
 
     if (currentState == GameState::LOADING) {
-        if (mapGenerationComplete.load(std::memory_order_acquire)) {
-            if (mapGenerationFuture.valid()) {
-                try {
-                    mapGenerationFuture.wait();
-                    
-                    if (tempMap && tempPlayer && tempCamera) {
-                        printf("[Game] Moving objects from temp storage to main game state (main thread)\n");
-                        
-                        if (player) {
-                            printf("[Game] Cleaning up old player resources\n");
-                            player->cleanup();
-                        }
-                        
-                        std::unique_ptr<Map> oldMap = std::move(map);
-                        std::unique_ptr<Player> oldPlayer = std::move(player);
-                        std::unique_ptr<GameCamera> oldCamera = std::move(camera);
-                        EnemyManager oldEnemyManager = std::move(enemyManager);
-                        
-                        map = std::move(tempMap);
-                        player = std::move(tempPlayer);
-                        camera = std::move(tempCamera);
-                        enemyManager = std::move(tempEnemyManager);
-                        
-
-                        
-                        oldMap.reset();
-                        oldPlayer.reset();
-                        oldCamera.reset();
-                        oldEnemyManager.clearEnemies();
-                        
-                        printf("[Game] Objects successfully moved to main game state\n");
-                    } else {
-                        printf("[Game] Warning: Some temp objects are null during transfer\n");
-                    }
-                    
-                    currentState = GameState::PLAYING;
-                } catch (const std::exception& e) {
-                    printf("[Game] Exception during async completion: %s\n", e.what());
-                    currentState = GameState::PLAYING;
-                }
-            } else {
-                currentState = GameState::PLAYING;
-            }
-        } else {
-            float loadingTime = GetTime() - loadingStartTime;
-            if (loadingTime > loadingTimeoutSeconds) {
-                mapGenerationInProgress.store(false, std::memory_order_release);
-                mapGenerationComplete.store(true, std::memory_order_release);
-                if (uiController && uiController->getLoadingScreen()) {
-                    uiController->getLoadingScreen()->setProgress(1.0f);
-                }
+        if (mapGenerationJob) {
+            uiController->getLoadingScreen()->setProgress(mapGenerationJob->getProgress());
+
+            if (mapGenerationJob->isFinished()) {
+                finishMapGeneration();
+            } else if (GetTime() - loadingStartTime > loadingTimeoutSeconds) {
+                printf("[Game] Map generation timed out after %.0f s\n", loadingTimeoutSeconds);
+                mapGenerationJob->cancel();
             }
         }
         uiController->update(deltaTime, currentState);
@@ -100,70 +68,199 @@ void Game::update(float deltaTime) {
     }
 
     if (currentState == GameState::PLAYING) {
-        if (mapGenerationInProgress.load(std::memory_order_acquire) || !map || !player || !camera) {
+        if (!map || !player || !camera) {
             uiController->update(deltaTime, currentState);
             return;
         }
         
-        automataTimer += deltaTime;
+        tickDeltaTime = deltaTime;
+        simulationGraph.execute();
+        PathfindingService::getInstance().update();
+
+        if (inputManager.isActionPressed(Core::InputAction::DEBUG_TOGGLE)) {
+            simulationGraph.printCriticalPath();
+            JobSystem::getInstance().dumpStats();
+            PathfindingService::getInstance().dumpStats();
+            enemyManager.getLodScheduler().dumpStats();
+            CombatResolver::getInstance().dumpStats();
+        }
+        // Its own key: 400 searches stall the frame, and the A* half reads
+        // Map::tiles, so it runs here between ticks rather than on a worker.
+        if (inputManager.isActionPressed(Core::InputAction::DEBUG_BENCHMARK)) {
+            BenchmarkGridSearch(*map, 200, 42);
+        }
+
+        if (player->getHealth() <= 0 && !gameOverTriggered) {
+            printf("[Game] Player health reached zero, transitioning to GAME_OVER state\n");
+            gameOverTriggered = true;
+            currentState = GameState::GAME_OVER;
+        }
 
+    } else if (currentState == GameState::PAUSED) {
+        uiController->update(deltaTime, currentState);
+    } else if (currentState == GameState::GAME_OVER) {
+        uiController->update(deltaTime, currentState);
+    }
+}
+
+namespace SimResource {
+    constexpr TaskResourceMask MAP_TILES = 1u << 0;
+    constexpr TaskResourceMask PARTICLES = 1u << 1;
+    constexpr TaskResourceMask PLAYER = 1u << 2;
+    constexpr TaskResourceMask CAMERA = 1u << 3;
+    constexpr TaskResourceMask ENEMIES = 1u << 4;
+    constexpr TaskResourceMask FLOW_FIELD = 1u << 5;
+    constexpr TaskResourceMask VISIBILITY = 1u << 6;
+    constexpr TaskResourceMask COLLISION_GRID = 1u << 7;
+    constexpr TaskResourceMask PROJECTILES = 1u << 8;
+    constexpr TaskResourceMask HITS = 1u << 9;
+}
+
+// Stages in their serial order. Enemy AI is parallel within its stage, but
+// its commands still write tiles (Detonode explosions) and the camera, so
+// the stage itself only overlaps with the particle stages. Stages that find
+// hits only read the player and the enemies and submit to CombatResolver;
+// the combat stage at the end applies them all.
+void Game::buildSimulationGraph() {
+    using namespace SimResource;
+    simulationGraph.clear();
+
+    simulationGraph.addTask("automata", 0, MAP_TILES, [this]() {
+        automataTimer += tickDeltaTime;
         if (automataTimer >= automataInterval) {
             map->applyConwayAutomata();
             automataTimer = 0.0f;
         }
+    });
 
-        map->updateTransitions(deltaTime);
-        map->updateLavaFlow(deltaTime);
+    simulationGraph.addTask("transitions", 0, MAP_TILES, [this]() {
+        map->updateTransitions(tickDeltaTime);
+    });
 
+    simulationGraph.addTask("lava", 0, MAP_TILES, [this]() {
+        map->updateLavaFlow(tickDeltaTime);
+    });
 
-        
-        map->updateParticles(deltaTime, player->getPosition());
-        ParticleSystem::getInstance().update(deltaTime);
-        player->update(deltaTime, *map, camera->getCamera(), enemyManager, inputManager);
-        camera->update(*player, *map, deltaTime);
+    simulationGraph.addTask("navgraph", 0, MAP_TILES, [this]() {
+        map->repairNavGraph();
+    });
+
+    simulationGraph.addTask("particles", 0, PARTICLES, [this]() {
+        ParticleSystem::getInstance().update(tickDeltaTime);
+    });
+
+    // Main thread: uploads the player texture once it has been decoded.
+    simulationGraph.addTask("player", MAP_TILES | CAMERA | COLLISION_GRID | ENEMIES, PLAYER | PROJECTILES | HITS, [this]() {
+        player->update(tickDeltaTime, *map, camera->getCamera(), enemyManager, Core::GetInputManager());
+    }, true);
 
-        enemyManager.updateEnemies(*map, player->getPosition(), deltaTime, *camera);
+    simulationGraph.addTask("camera", PLAYER | MAP_TILES, CAMERA, [this]() {
+        camera->update(*player, *map, tickDeltaTime);
+    });
+
+    simulationGraph.addTask("flowfield", MAP_TILES | PLAYER, FLOW_FIELD, [this]() {
+        FlowField::getInstance().update(player->getPosition());
+    });
+
+    simulationGraph.addTask("visibility", MAP_TILES | PLAYER, VISIBILITY, [this]() {
+        PlayerVisibility::getInstance().update(player->getPosition());
+    });
+
+    simulationGraph.addTask("enemies", FLOW_FIELD | VISIBILITY | PLAYER, ENEMIES | MAP_TILES | CAMERA | PROJECTILES | HITS, [this]() {
+        enemyManager.updateEnemies(*map, *player, tickDeltaTime, *camera);
         enemyManager.removeDeadEnemies();
+    });
+
+    // After the enemy stage, so contacts see this tick's positions; next
+    // tick's player stage queries it before it is rebuilt.
+    simulationGraph.addTask("broadphase", ENEMIES | PLAYER, COLLISION_GRID, [this]() {
+        CollisionGrid& grid = CollisionGrid::getInstance();
+        grid.clear();
 
-        auto scrapHounds = enemyManager.getEnemiesOfType(EnemyType::SCRAP_HOUND);
-        for (auto* enemy : scrapHounds) {
-            Vector2 enemyPos = enemy->getPosition();
-            Rectangle enemyRect = { enemyPos.x, enemyPos.y, 32, 32 };
-            
-            Vector2 playerPos = player->getPosition();
-            Rectangle playerRect = { playerPos.x, playerPos.y, 32, 32 };
-            
-            if (CheckCollisionRecs(enemyRect, playerRect) && player->canTakeDamage()) {
-                player->takeDamage(5);
-                camera->addScreenshake(0.3f, 0.2f);
+        Vector2 playerPos = player->getPosition();
+        grid.add({ playerPos.x, playerPos.y, 32, 32 }, ColliderKind::PLAYER);
+
+        auto& hounds = enemyManager.getScrapHounds();
+        for (size_t i = 0; i < hounds.size(); ++i) {
+            if (hounds[i].isAlive()) {
+                grid.add(hounds[i].getArrowHitbox(), ColliderKind::ENEMY, hounds.handleAt(i));
             }
         }
 
-        auto automatons = enemyManager.getEnemiesOfType(EnemyType::AUTOMATON);
-        for (auto* enemy : automatons) {
-            Automaton* automaton = static_cast<Automaton*>(enemy);
-            automaton->checkProjectileCollisions(*player, *camera);
-            
-            Rectangle automatonRect = automaton->getHitbox();
-            
-            Vector2 playerPos = player->getPosition();
-            Rectangle playerRect = { playerPos.x, playerPos.y, 32, 32 };
-            
-            if (CheckCollisionRecs(automatonRect, playerRect) && player->canTakeDamage()) {
-                player->takeDamage(10);
-                camera->addScreenshake(0.5f, 0.3f);
+        auto& automatons = enemyManager.getAutomatons();
+        for (size_t i = 0; i < automatons.size(); ++i) {
+            if (automatons[i].isAlive()) {
+                grid.add(automatons[i].getHitbox(), ColliderKind::ENEMY, automatons.handleAt(i));
             }
         }
 
-        if (player->getHealth() <= 0 && !gameOverTriggered) {
-            printf("[Game] Player health reached zero, transitioning to GAME_OVER state\n");
-            gameOverTriggered = true;
-            currentState = GameState::GAME_OVER;
+        auto& detonodes = enemyManager.getDetonodes();
+        for (size_t i = 0; i < detonodes.size(); ++i) {
+            if (detonodes[i].isAlive()) {
+                grid.add(detonodes[i].getHitbox(), ColliderKind::ENEMY, detonodes.handleAt(i));
+            }
         }
 
-    } else if (currentState == GameState::PAUSED) {
-        uiController->update(deltaTime, currentState);
-    } else if (currentState == GameState::GAME_OVER) {
-        uiController->update(deltaTime, currentState);
-    }
+        grid.build();
+    });
+
+    simulationGraph.addTask("projectiles", MAP_TILES | COLLISION_GRID | ENEMIES | PLAYER, PROJECTILES | HITS, [this]() {
+        ProjectileSystem::getInstance().update(tickDeltaTime, *map, enemyManager, *player);
+    });
+
+    simulationGraph.addTask("contacts", COLLISION_GRID | ENEMIES | PLAYER, HITS, [this]() {
+        // Nothing it finds could land.
+        if (!player->canTakeDamage()) return;
+
+        const CollisionGrid& grid = CollisionGrid::getInstance();
+        thread_local std::vector<ColliderId> touching;
+        touching.clear();
+        grid.forEachPair(ColliderMask::PLAYER, ColliderMask::ENEMY, [](ColliderId, ColliderId other) {
+            touching.push_back(other);
+        });
+        // Add order, which is the order the checks always ran in.
+        std::sort(touching.begin(), touching.end());
+
+        Vector2 playerPos = player->getPosition();
+        Rectangle playerRect = { playerPos.x, playerPos.y, 32, 32 };
+        CombatResolver& combat = CombatResolver::getInstance();
+
+        for (ColliderId id : touching) {
+            const Collider& collider = grid.get(id);
+            if (collider.enemy.type == EnemyType::SCRAP_HOUND) {
+                ScrapHound* hound = enemyManager.getScrapHounds().get(collider.enemy);
+                if (!hound || !hound->isAlive()) continue;
+                Vector2 enemyPos = hound->getPosition();
+                Rectangle enemyRect = { enemyPos.x, enemyPos.y, 32, 32 };
+                
+                if (CheckCollisionRecs(enemyRect, playerRect)) {
+                    HitCandidate hit;
+                    hit.source = HitSource::CONTACT;
+                    hit.sourceId = id;
+                    hit.damage = 5;
+                    hit.shakeIntensity = 0.3f;
+                    hit.shakeDuration = 0.2f;
+                    combat.submit(hit);
+                }
+            } else if (collider.enemy.type == EnemyType::AUTOMATON) {
+                Automaton* automaton = enemyManager.getAutomatons().get(collider.enemy);
+                if (!automaton || !automaton->isAlive()) continue;
+                Rectangle automatonRect = automaton->getHitbox();
+                
+                if (CheckCollisionRecs(automatonRect, playerRect)) {
+                    HitCandidate hit;
+                    hit.source = HitSource::CONTACT;
+                    hit.sourceId = id;
+                    hit.damage = 10;
+                    hit.shakeIntensity = 0.5f;
+                    hit.shakeDuration = 0.3f;
+                    combat.submit(hit);
+                }
+            }
+        }
+    });
+
+    simulationGraph.addTask("combat", 0, HITS | ENEMIES | PLAYER | CAMERA, [this]() {
+        CombatResolver::getInstance().resolve(enemyManager, *player, *camera);
+    });
 }
@@ -0,0 +1,73 @@
+#include "MapGenerationJob.hpp"
+#include "Spawner.hpp"
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+
+MapGenerationJob::MapGenerationJob(std::shared_ptr<Core::ResourcePreloadJob> tilePreload, Spawner& spawner,
+                                   int screenWidth, int screenHeight)
+    : LongJob("MapGeneration", JobPriority::STREAMING),
+      tilePreload(std::move(tilePreload)),
+      spawner(spawner),
+      screenWidth(screenWidth),
+      screenHeight(screenHeight) {
+}
+
+LongJob::Step MapGenerationJob::resume() {
+    switch (state) {
+    case WAIT_FOR_TILES:
+        state = CREATE_MAP;
+        if (!tilePreload->isFinished()) {
+            reportProgress(0.0f, "Loading tiles");
+            awaitJob(tilePreload);
+            return Step::AWAIT;
+        }
+        return Step::YIELD;
+
+    case CREATE_MAP: {
+        if (tilePreload->getStatus() != Status::DONE) {
+            throw std::runtime_error("tile preload did not complete");
+        }
+
+        std::vector<Texture2D> tileTextures;
+        tileTextures.reserve(tilePreload->getTextures().size());
+        for (const auto& handle : tilePreload->getTextures()) {
+            tileTextures.push_back(*handle.get());
+        }
+
+        // Map generation reports progress between its phases; those points
+        // double as cancellation points so an abandoned load unwinds there.
+        auto progressCallback = [this](float fraction) {
+            throwIfCancelled();
+            reportProgress(0.05f + fraction * 0.8f, "Generating map");
+        };
+
+        printf("[Game] Starting map generation (500x300)...\n");
+        auto start = std::chrono::high_resolution_clock::now();
+        map = std::make_unique<Map>(500, 300, tileTextures, progressCallback);
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start);
+        printf("[Game] Map generation completed in %ld ms\n", static_cast<long>(duration.count()));
+
+        state = CREATE_PLAYER;
+        return Step::YIELD;
+    }
+
+    case CREATE_PLAYER:
+        reportProgress(0.9f, "Creating player");
+        player = std::make_unique<Player>(*map);
+        map->setPlayer(player.get());
+        camera = std::make_unique<GameCamera>(screenWidth, screenHeight, *player);
+        state = SPAWN_ENEMIES;
+        return Step::YIELD;
+
+    case SPAWN_ENEMIES: {
+        reportProgress(0.95f, "Spawning enemies");
+        auto start = std::chrono::high_resolution_clock::now();
+        spawner.spawnEnemiesInRooms(*map, enemyManager);
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start);
+        printf("[Game] Enemy spawning completed in %ld ms\n", static_cast<long>(duration.count()));
+        return Step::DONE;
+    }
+    }
+    return Step::DONE;
+}
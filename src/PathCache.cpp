@@ -0,0 +1,114 @@
+#include "PathCache.hpp"
+#include <algorithm>
+
+namespace {
+    Vector2 CellPosition(int x, int y) {
+        return Vector2{ x * 32.0f, y * 32.0f };
+    }
+
+    void AppendDistinct(std::vector<Vector2>& path, Vector2 position) {
+        if (!path.empty() && path.back().x == position.x && path.back().y == position.y) return;
+        path.push_back(position);
+    }
+
+    void AddChunk(std::vector<int32_t>& corridor, int32_t chunk) {
+        if (std::find(corridor.begin(), corridor.end(), chunk) == corridor.end()) {
+            corridor.push_back(chunk);
+        }
+    }
+}
+
+uint64_t PathCache::keyOf(int32_t startSpan, int32_t goalSpan) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(startSpan)) << 32) | static_cast<uint32_t>(goalSpan);
+}
+
+bool PathCache::isFresh(const NavGraph& graph, const Entry& entry) const {
+    for (int32_t chunk : entry.corridor) {
+        if (!graph.isChunkUnchangedSince(chunk, entry.revision)) return false;
+    }
+    return true;
+}
+
+bool PathCache::lookup(const NavGraph& graph, Vector2 start, Vector2 goal, std::vector<Vector2>& out) {
+    int sx = 0, sy = 0, gx = 0, gy = 0;
+    int32_t startSpan = graph.spanUnder(start, &sx, &sy);
+    int32_t goalSpan = graph.spanUnder(goal, &gx, &gy);
+    auto it = startSpan >= 0 && goalSpan >= 0 ? entries.find(keyOf(startSpan, goalSpan)) : entries.end();
+    if (it == entries.end()) {
+        ++stats.misses;
+        return false;
+    }
+
+    // Span ids are recycled by repairs; the corridor holds the chunks of both
+    // end spans, so a recycled id always shows up as stale here.
+    Entry& entry = it->second;
+    if (!isFresh(graph, entry)) {
+        entries.erase(it);
+        ++stats.stale;
+        ++stats.misses;
+        return false;
+    }
+    entry.lastUsed = ++useClock;
+    out.clear();
+    AppendDistinct(out, CellPosition(sx, sy));
+    for (const Vector2& position : entry.path) {
+        AppendDistinct(out, position);
+    }
+    AppendDistinct(out, CellPosition(gx, gy));
+    ++stats.hits;
+    return true;
+}
+
+void PathCache::insert(const NavGraph& graph, Vector2 start, Vector2 goal, const std::vector<NavWaypoint>& route, uint64_t revision) {
+    if (route.empty()) return;
+
+    int sx = 0, sy = 0, gx = 0, gy = 0;
+    int32_t startSpan = graph.spanUnder(start, &sx, &sy);
+    int32_t goalSpan = graph.spanUnder(goal, &gx, &gy);
+    if (startSpan < 0 || goalSpan < 0) return;
+
+    auto [it, added] = entries.try_emplace(keyOf(startSpan, goalSpan));
+    Entry& entry = it->second;
+    // A newer search already refreshed this pair.
+    if (!added && entry.revision > revision) return;
+
+    entry.revision = revision;
+    entry.lastUsed = ++useClock;
+    entry.corridor.clear();
+    AddChunk(entry.corridor, graph.chunkAt(CellPosition(sx, sy)));
+    AddChunk(entry.corridor, graph.chunkAt(CellPosition(gx, gy)));
+    entry.path.clear();
+    for (const NavWaypoint& waypoint : route) {
+        entry.path.push_back(waypoint.position);
+        AddChunk(entry.corridor, graph.chunkAt(waypoint.position));
+    }
+    // Keep only the first point on the goal span; lookups walk on from there
+    // to their own goal cell.
+    while (entry.path.size() > 1 && graph.spanUnder(entry.path[entry.path.size() - 2]) == goalSpan) {
+        entry.path.pop_back();
+    }
+
+    if (entries.size() > MAX_ENTRIES) evictOldest();
+}
+
+void PathCache::evictOldest() {
+    auto oldest = entries.end();
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (oldest == entries.end() || it->second.lastUsed < oldest->second.lastUsed) {
+            oldest = it;
+        }
+    }
+    if (oldest == entries.end()) return;
+    entries.erase(oldest);
+    ++stats.evictions;
+}
+
+void PathCache::clear() {
+    entries.clear();
+}
+
+PathCacheStats PathCache::getStats() const {
+    PathCacheStats result = stats;
+    result.entries = entries.size();
+    return result;
+}
@@ -1,82 +1,435 @@
 #include "Pathfinding.hpp"
 #include "map/Map.hpp"
-#include <raymath.h>
+#include "map/NavHierarchy.hpp"
+#include "map/NavGraph.hpp"
+#include "map/TileMask.hpp"
+#include "core/FastRNG.hpp"
 #include <algorithm>
-#include <queue>
-#include <unordered_map>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <tuple>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
-static float Heuristic(int x1, int y1, int x2, int y2) {
-    return fabsf((float)x1 - x2) + fabsf((float)y1 - y2);
+namespace {
+    struct OpenEntry {
+        float f;
+        float g;
+        int32_t index;
+    };
+
+    // Min-heap on f; on ties prefer the deeper node so the search runs
+    // straight at the goal instead of widening.
+    struct OpenEntryGreater {
+        bool operator()(const OpenEntry& a, const OpenEntry& b) const {
+            if (a.f != b.f) return a.f > b.f;
+            return a.g < b.g;
+        }
+    };
+
+    struct SearchScratch {
+        int width = 0;
+        int height = 0;
+        uint32_t generation = 0;
+        std::vector<uint32_t> stamp;   // cell is valid for this search iff stamp == generation
+        std::vector<float> gScore;
+        std::vector<int32_t> parent;
+        std::vector<OpenEntry> open;
+
+        void begin(int w, int h) {
+            if (w != width || h != height) {
+                width = w;
+                height = h;
+                size_t cells = static_cast<size_t>(w) * static_cast<size_t>(h);
+                stamp.assign(cells, 0);
+                gScore.resize(cells);
+                parent.resize(cells);
+                generation = 0;
+            }
+            if (++generation == 0) {
+                std::fill(stamp.begin(), stamp.end(), 0);
+                generation = 1;
+            }
+            open.clear();
+        }
+
+        bool seen(int32_t index) const { return stamp[index] == generation; }
+    };
+
+    thread_local SearchScratch scratch;
+
+    float Heuristic(int x1, int y1, int x2, int y2) {
+        return fabsf((float)x1 - x2) + fabsf((float)y1 - y2);
+    }
+
+    bool IsWalkable(const Map& map, int x, int y) {
+        return map.isTileEmpty(x, y) && map.isSolidTile(x, y + 1);
+    }
+
+    int LowestBit(uint64_t m) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, m);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(m);
+#endif
+    }
+
+    int HighestBit(uint64_t m) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, m);
+        return static_cast<int>(index);
+#else
+        return 63 - __builtin_clzll(m);
+#endif
+    }
+
+    // First position at or past from (stepping by dir) whose bit is set in
+    // stopWord(word), or -1 when a backward scan runs off the start. Stop
+    // words must flag out-of-range cells so a forward scan terminates.
+    template <typename StopWord>
+    int ScanLine(int from, int dir, StopWord stopWord) {
+        if (from < 0) return -1;
+        int word = from >> 6;
+        if (dir > 0) {
+            uint64_t m = stopWord(word) & (~uint64_t(0) << (from & 63));
+            while (!m) m = stopWord(++word);
+            return word * 64 + LowestBit(m);
+        }
+        uint64_t m = stopWord(word) & (~uint64_t(0) >> (63 - (from & 63)));
+        while (!m) {
+            if (--word < 0) return -1;
+            m = stopWord(word);
+        }
+        return word * 64 + HighestBit(m);
+    }
+
+    // Jump Point Search for the 4-connected case. Canonical routes go
+    // horizontal first; a vertical run only turns where the cell beside it
+    // and one step back is blocked. Horizontal jumps therefore probe
+    // vertically at every cell that has a walkable cell above or below,
+    // and vertical jumps stop at those forced turns.
+    class JumpPointSearch {
+    public:
+        JumpPointSearch(const TileMask& mask, int gx, int gy)
+            : mask(mask), height(mask.getHeight()), gx(gx), gy(gy) {}
+
+        // Both return the jump point's cell index, or -1.
+        int32_t jumpHorizontal(int x, int y, int dx) const {
+            auto stopWord = [&](int word) {
+                uint64_t stop = ~mask.rowWord(y, word) | mask.rowWord(y - 1, word) | mask.rowWord(y + 1, word);
+                if (y == gy && word == (gx >> 6)) stop |= uint64_t(1) << (gx & 63);
+                return stop;
+            };
+            for (int cx = x + dx;; cx += dx) {
+                cx = ScanLine(cx, dx, stopWord);
+                if (!mask.isWalkable(cx, y)) return -1;
+                if (cx == gx && y == gy) return indexOf(cx, y);
+                if (jumpVertical(cx, y, 1) >= 0 || jumpVertical(cx, y, -1) >= 0) return indexOf(cx, y);
+            }
+        }
+
+        int32_t jumpVertical(int x, int y, int dy) const {
+            // Bit y of a side column's forced word: walkable at y but not at y - dy.
+            auto forced = [&](int column, int word) {
+                uint64_t here = mask.columnWord(column, word);
+                uint64_t behind = dy > 0
+                    ? (here << 1) | (mask.columnWord(column, word - 1) >> 63)
+                    : (here >> 1) | (mask.columnWord(column, word + 1) << 63);
+                return here & ~behind;
+            };
+            auto stopWord = [&](int word) {
+                uint64_t stop = ~mask.columnWord(x, word) | forced(x - 1, word) | forced(x + 1, word);
+                if (x == gx && word == (gy >> 6)) stop |= uint64_t(1) << (gy & 63);
+                return stop;
+            };
+            int cy = ScanLine(y + dy, dy, stopWord);
+            if (!mask.isWalkable(x, cy)) return -1;
+            return indexOf(x, cy);
+        }
+
+        bool isForcedTurn(int x, int y, int side, int dy) const {
+            return mask.isWalkable(x + side, y) && !mask.isWalkable(x + side, y - dy);
+        }
+
+        int32_t indexOf(int x, int y) const { return static_cast<int32_t>(x * height + y); }
+
+    private:
+        const TileMask& mask;
+        int height;
+        int gx;
+        int gy;
+    };
 }
 
-std::vector<Vector2> FindPathAStar(const Map& map, Vector2 start, Vector2 goal) {
+bool FindPathAStar(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, int* expansions) {
+    outPath.clear();
+    if (expansions) *expansions = 0;
+
+    int width = map.getWidth();
+    int height = map.getHeight();
     int sx = (int)((start.x + 16) / 32);
     int sy = (int)((start.y + 32) / 32);
     int gx = (int)((goal.x + 16) / 32);
     int gy = (int)((goal.y + 32) / 32);
+    if (sx < 0 || sy < 0 || sx >= width || sy >= height) return false;
+    if (gx < 0 || gy < 0 || gx >= width || gy >= height) return false;
 
-    auto hash = [](int x, int y) { return x * 10000 + y; };
+    SearchScratch& s = scratch;
+    s.begin(width, height);
 
-    std::priority_queue<
-        std::pair<float, Node*>,
-        std::vector<std::pair<float, Node*>>,
-        std::greater<>
-    > openSet;
+    auto indexOf = [height](int x, int y) { return static_cast<int32_t>(x * height + y); };
 
-    std::unordered_map<int, Node*> allNodes;
-    std::unordered_map<int, float> gScore;
+    int32_t startIndex = indexOf(sx, sy);
+    int32_t goalIndex = indexOf(gx, gy);
+    s.stamp[startIndex] = s.generation;
+    s.gScore[startIndex] = 0.0f;
+    s.parent[startIndex] = -1;
+    s.open.push_back({ Heuristic(sx, sy, gx, gy), 0.0f, startIndex });
 
-    Node* startNode = new Node(sx, sy, 0.0f, Heuristic(sx, sy, gx, gy), nullptr);
-    openSet.push({startNode->f, startNode});
-    allNodes[hash(sx, sy)] = startNode;
-    gScore[hash(sx, sy)] = 0.0f;
+    const int dirs[4][2] = { {1,0}, {-1,0}, {0,1}, {0,-1} };
+    bool found = false;
 
-    int dirs[4][2] = { {1,0}, {-1,0}, {0,1}, {0,-1} };
+    while (!s.open.empty()) {
+        std::pop_heap(s.open.begin(), s.open.end(), OpenEntryGreater());
+        OpenEntry current = s.open.back();
+        s.open.pop_back();
 
-    Node* endNode = nullptr;
+        // Stale entry: a cheaper route to this cell was queued after it.
+        if (current.g > s.gScore[current.index]) continue;
+        if (expansions) ++*expansions;
 
-    while (!openSet.empty()) {
-        Node* current = openSet.top().second;
-        openSet.pop();
-
-        if (current->x == gx && current->y == gy) {
-            endNode = current;
+        if (current.index == goalIndex) {
+            found = true;
             break;
         }
 
-        for (auto& d : dirs) {
-            int nx = current->x + d[0];
-            int ny = current->y + d[1];
-
-            if (nx < 0 || ny < 0 || nx >= 500 || ny >= 300) continue;
-            if (!map.isTileEmpty(nx, ny)) continue;
-            if (!map.isSolidTile(nx, ny + 1)) continue;
+        int cx = current.index / height;
+        int cy = current.index % height;
+        for (const auto& d : dirs) {
+            int nx = cx + d[0];
+            int ny = cy + d[1];
 
-            float tentative_g = current->g + 1.0f;
-            int nhash = hash(nx, ny);
+            if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+            if (!IsWalkable(map, nx, ny)) continue;
 
-            if (!gScore.count(nhash) || tentative_g < gScore[nhash]) {
-                gScore[nhash] = tentative_g;
-                Node* neighbor = new Node(nx, ny, tentative_g, Heuristic(nx, ny, gx, gy), current);
-                openSet.push({neighbor->f, neighbor});
-                allNodes[nhash] = neighbor;
+            int32_t neighbor = indexOf(nx, ny);
+            float tentativeG = current.g + 1.0f;
+            if (!s.seen(neighbor) || tentativeG < s.gScore[neighbor]) {
+                s.stamp[neighbor] = s.generation;
+                s.gScore[neighbor] = tentativeG;
+                s.parent[neighbor] = current.index;
+                s.open.push_back({ tentativeG + Heuristic(nx, ny, gx, gy), tentativeG, neighbor });
+                std::push_heap(s.open.begin(), s.open.end(), OpenEntryGreater());
             }
         }
     }
 
+    if (!found) return false;
+
+    for (int32_t n = goalIndex; n != startIndex; n = s.parent[n]) {
+        outPath.push_back(Vector2{ (n / height) * 32.0f, (n % height) * 32.0f });
+    }
+    std::reverse(outPath.begin(), outPath.end());
+    return true;
+}
+
+std::vector<Vector2> FindPathAStar(const Map& map, Vector2 start, Vector2 goal) {
     std::vector<Vector2> path;
-    if (endNode) {
-        Node* n = endNode;
-        while (n && !(n->x == sx && n->y == sy)) {
-            path.push_back(Vector2{n->x * 32.0f, n->y * 32.0f});
-            n = n->parent;
+    FindPathAStar(map, start, goal, path);
+    return path;
+}
+
+bool FindPathJPS(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, int* expansions) {
+    const TileMask* mask = map.getTileMask();
+    if (!mask) return FindPathAStar(map, start, goal, outPath, expansions);
+
+    outPath.clear();
+    if (expansions) *expansions = 0;
+
+    int width = map.getWidth();
+    int height = map.getHeight();
+    int sx = (int)((start.x + 16) / 32);
+    int sy = (int)((start.y + 32) / 32);
+    int gx = (int)((goal.x + 16) / 32);
+    int gy = (int)((goal.y + 32) / 32);
+    if (sx < 0 || sy < 0 || sx >= width || sy >= height) return false;
+    if (gx < 0 || gy < 0 || gx >= width || gy >= height) return false;
+
+    SearchScratch& s = scratch;
+    s.begin(width, height);
+    JumpPointSearch jps(*mask, gx, gy);
+
+    int32_t startIndex = jps.indexOf(sx, sy);
+    int32_t goalIndex = jps.indexOf(gx, gy);
+    s.stamp[startIndex] = s.generation;
+    s.gScore[startIndex] = 0.0f;
+    s.parent[startIndex] = -1;
+    s.open.push_back({ Heuristic(sx, sy, gx, gy), 0.0f, startIndex });
+
+    auto push = [&](int32_t from, float g, int32_t to) {
+        if (to < 0) return;
+        int tx = to / height;
+        int ty = to % height;
+        float tentativeG = g + fabsf((float)(tx - from / height)) + fabsf((float)(ty - from % height));
+        if (!s.seen(to) || tentativeG < s.gScore[to]) {
+            s.stamp[to] = s.generation;
+            s.gScore[to] = tentativeG;
+            s.parent[to] = from;
+            s.open.push_back({ tentativeG + Heuristic(tx, ty, gx, gy), tentativeG, to });
+            std::push_heap(s.open.begin(), s.open.end(), OpenEntryGreater());
+        }
+    };
+
+    bool found = false;
+    while (!s.open.empty()) {
+        std::pop_heap(s.open.begin(), s.open.end(), OpenEntryGreater());
+        OpenEntry current = s.open.back();
+        s.open.pop_back();
+
+        if (current.g > s.gScore[current.index]) continue;
+        if (expansions) ++*expansions;
+
+        if (current.index == goalIndex) {
+            found = true;
+            break;
+        }
+
+        int cx = current.index / height;
+        int cy = current.index % height;
+        int32_t parent = s.parent[current.index];
+        if (parent < 0) {
+            push(current.index, current.g, jps.jumpHorizontal(cx, cy, 1));
+            push(current.index, current.g, jps.jumpHorizontal(cx, cy, -1));
+            push(current.index, current.g, jps.jumpVertical(cx, cy, 1));
+            push(current.index, current.g, jps.jumpVertical(cx, cy, -1));
+        } else if (parent % height == cy) {
+            int dx = cx > parent / height ? 1 : -1;
+            push(current.index, current.g, jps.jumpHorizontal(cx, cy, dx));
+            push(current.index, current.g, jps.jumpVertical(cx, cy, 1));
+            push(current.index, current.g, jps.jumpVertical(cx, cy, -1));
+        } else {
+            int dy = cy > parent % height ? 1 : -1;
+            push(current.index, current.g, jps.jumpVertical(cx, cy, dy));
+            for (int side : { -1, 1 }) {
+                if (jps.isForcedTurn(cx, cy, side, dy)) {
+                    push(current.index, current.g, jps.jumpHorizontal(cx, cy, side));
+                }
+            }
         }
-        std::reverse(path.begin(), path.end());
     }
 
-    for (auto& kv : allNodes) {
-        delete kv.second;
+    if (!found) return false;
+
+    // Jump points are joined by straight runs; emit every tile on them.
+    for (int32_t n = goalIndex; n != startIndex; n = s.parent[n]) {
+        int x = n / height;
+        int y = n % height;
+        int px = s.parent[n] / height;
+        int py = s.parent[n] % height;
+        int stepX = (px > x) - (px < x);
+        int stepY = (py > y) - (py < y);
+        for (; x != px || y != py; x += stepX, y += stepY) {
+            outPath.push_back(Vector2{ x * 32.0f, y * 32.0f });
+        }
     }
-    return path;
+    std::reverse(outPath.begin(), outPath.end());
+    return true;
+}
+
+bool FindPathGrid(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, GridSearch mode, int* expansions) {
+    if (mode == GridSearch::JUMP_POINT) {
+        return FindPathJPS(map, start, goal, outPath, expansions);
+    }
+    return FindPathAStar(map, start, goal, outPath, expansions);
+}
+
+bool FindPathHierarchical(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, GridSearch fallback) {
+    const NavHierarchy* hierarchy = map.getNavHierarchy();
+    if (hierarchy && hierarchy->findPath(map, start, goal, outPath)) {
+        return true;
+    }
+    return FindPathGrid(map, start, goal, outPath, fallback);
+}
+
+bool FindPathPlatformer(const Map& map, Vector2 start, Vector2 goal, std::vector<NavWaypoint>& outPath) {
+    const NavGraph* graph = map.getNavGraph();
+    if (graph && graph->findPath(start, goal, outPath)) {
+        return true;
+    }
+
+    thread_local std::vector<Vector2> gridPath;
+    outPath.clear();
+    if (!FindPathHierarchical(map, start, goal, gridPath)) return false;
+    for (const Vector2& position : gridPath) {
+        outPath.push_back({ position, NavLink::WALK });
+    }
+    return true;
+}
+
+void BenchmarkGridSearch(const Map& map, int queryCount, uint64_t seed) {
+    const TileMask* mask = map.getTileMask();
+    if (!mask || queryCount <= 0) return;
+
+    std::vector<std::pair<int, int>> cells;
+    for (int x = 0; x < map.getWidth(); ++x) {
+        for (int y = 0; y < map.getHeight(); ++y) {
+            if (mask->isWalkable(x, y)) cells.push_back({ x, y });
+        }
+    }
+    if (cells.empty()) return;
+
+    // Half the goals share the start's floor row (corridor runs), half are
+    // anywhere on the map.
+    FastRNG rng(seed);
+    std::vector<std::pair<Vector2, Vector2>> queries;
+    queries.reserve(queryCount);
+    for (int i = 0; i < queryCount; ++i) {
+        auto [sx, sy] = cells[rng.nextUInt(static_cast<uint32_t>(cells.size()))];
+        int gx = sx;
+        int gy = sy;
+        if (i % 2 == 0) {
+            int x0 = sx;
+            int x1 = sx;
+            while (mask->isWalkable(x0 - 1, sy)) --x0;
+            while (mask->isWalkable(x1 + 1, sy)) ++x1;
+            gx = x0 + static_cast<int>(rng.nextUInt(static_cast<uint32_t>(x1 - x0 + 1)));
+        } else {
+            std::tie(gx, gy) = cells[rng.nextUInt(static_cast<uint32_t>(cells.size()))];
+        }
+        // Inverse of the searches' cell rounding.
+        queries.push_back({ Vector2{ sx * 32.0f, sy * 32.0f - 32.0f }, Vector2{ gx * 32.0f, gy * 32.0f - 32.0f } });
+    }
+
+    std::vector<Vector2> path;
+    std::vector<size_t> lengths(queries.size());
+    auto run = [&](GridSearch mode, bool compare, uint64_t& totalExpansions, int& mismatches) {
+        totalExpansions = 0;
+        mismatches = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < queries.size(); ++i) {
+            int expansions = 0;
+            FindPathGrid(map, queries[i].first, queries[i].second, path, mode, &expansions);
+            totalExpansions += expansions;
+            if (compare && path.size() != lengths[i]) ++mismatches;
+            lengths[i] = path.size();
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    };
+
+    uint64_t astarExpansions;
+    uint64_t jpsExpansions;
+    int mismatches;
+    double astarMs = run(GridSearch::ASTAR, false, astarExpansions, mismatches);
+    double jpsMs = run(GridSearch::JUMP_POINT, true, jpsExpansions, mismatches);
+    printf("[Pathfinding] Grid benchmark, %d queries: A* %llu expansions %.2f ms, JPS %llu expansions %.2f ms, %d length mismatches\n",
+           queryCount,
+           static_cast<unsigned long long>(astarExpansions), astarMs,
+           static_cast<unsigned long long>(jpsExpansions), jpsMs,
+           mismatches);
 }
@@ -0,0 +1,225 @@
+#include "PathfindingService.hpp"
+#include "Pathfinding.hpp"
+#include "core/JobSystem.hpp"
+#include "map/Map.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+
+PathfindingService& PathfindingService::getInstance() {
+    static PathfindingService instance;
+    return instance;
+}
+
+PathfindingService::Slot* PathfindingService::findSlot(PathHandle handle) {
+    if (handle.index >= slots.size()) return nullptr;
+    Slot& slot = slots[handle.index];
+    return slot.inUse && slot.generation == handle.generation ? &slot : nullptr;
+}
+
+const PathfindingService::Slot* PathfindingService::findSlot(PathHandle handle) const {
+    if (handle.index >= slots.size()) return nullptr;
+    const Slot& slot = slots[handle.index];
+    return slot.inUse && slot.generation == handle.generation ? &slot : nullptr;
+}
+
+PathHandle PathfindingService::acquire() {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint32_t index;
+    if (freeSlots.empty()) {
+        index = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    } else {
+        index = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    slots[index].inUse = true;
+    return { index, slots[index].generation };
+}
+
+void PathfindingService::release(PathHandle handle) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Slot* slot = findSlot(handle);
+    if (!slot) return;
+
+    // The index may still sit in requestQueue or be running; both check the
+    // generation, so bumping it is enough to orphan them, and the slot is
+    // free to run a new query straight away.
+    slot->inUse = false;
+    slot->generation++;
+    slot->queued = false;
+    slot->running = false;
+    slot->delivered = false;
+    slot->mailbox.clear();
+    freeSlots.push_back(handle.index);
+}
+
+void PathfindingService::request(PathHandle handle, Vector2 start, Vector2 goal) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Slot* slot = findSlot(handle);
+    if (!slot) return;
+
+    slot->start = start;
+    slot->goal = goal;
+    if (!slot->queued) {
+        slot->queued = true;
+        requestQueue.push_back(handle.index);
+    }
+}
+
+bool PathfindingService::isPending(PathHandle handle) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const Slot* slot = findSlot(handle);
+    return slot && (slot->queued || slot->running);
+}
+
+bool PathfindingService::poll(PathHandle handle, std::vector<Vector2>& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Slot* slot = findSlot(handle);
+    if (!slot || !slot->delivered) return false;
+
+    // Swapping hands the caller's old buffer back as the next mailbox, so
+    // neither side reallocates once both have grown.
+    out.swap(slot->mailbox);
+    slot->delivered = false;
+    return true;
+}
+
+void PathfindingService::setMap(const Map* newMap) {
+    std::unique_lock<std::mutex> lock(mutex);
+    requestQueue.clear();
+    dispatchQueue.clear();
+    idleCondition.wait(lock, [this] { return activeWorkers == 0; });
+
+    // Dropped dispatches never reach a worker, so nothing else would
+    // clear their running flag.
+    for (auto& slot : slots) {
+        slot.queued = false;
+        slot.running = false;
+        slot.delivered = false;
+        slot.mailbox.clear();
+    }
+    cache.clear();
+    map = newMap;
+}
+
+void PathfindingService::update() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!map) return;
+
+    // A slot whose previous search is still running keeps its place at the
+    // front so its newer request goes out next frame.
+    const NavGraph* graph = map->getNavGraph();
+    size_t deferred = 0;
+    int released = 0;
+    while (released < queryBudget && deferred < requestQueue.size()) {
+        uint32_t index = requestQueue[deferred];
+        Slot& slot = slots[index];
+        if (!slot.queued) {
+            requestQueue.erase(requestQueue.begin() + deferred);
+            continue;
+        }
+        if (slot.running) {
+            ++deferred;
+            continue;
+        }
+        requestQueue.erase(requestQueue.begin() + deferred);
+        slot.queued = false;
+        if (graph && cache.lookup(*graph, slot.start, slot.goal, slot.mailbox)) {
+            slot.delivered = true;
+            continue;
+        }
+        slot.running = true;
+        dispatchQueue.push_back({ { index, slot.generation }, slot.start, slot.goal });
+        ++released;
+    }
+
+    int spawn = std::min(maxWorkers - activeWorkers, static_cast<int>(dispatchQueue.size()));
+    for (int i = 0; i < spawn; ++i) {
+        try {
+            JobSystem::getInstance().submit(JobPriority::IDLE, [this]() { workerLoop(); });
+        } catch (const std::runtime_error&) {
+            break;
+        }
+        ++activeWorkers;
+    }
+}
+
+void PathfindingService::workerLoop() {
+    // Both keep their capacity across queries, so steady-state searches don't allocate.
+    thread_local std::vector<NavWaypoint> route;
+    thread_local std::vector<Vector2> result;
+
+    for (;;) {
+        Query query;
+        const Map* searchMap;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (dispatchQueue.empty()) {
+                --activeWorkers;
+                idleCondition.notify_all();
+                return;
+            }
+            query = dispatchQueue.front();
+            dispatchQueue.pop_front();
+            searchMap = map;
+
+            // release() already cleared the slot, which may since run a newer query.
+            if (!findSlot(query.handle)) continue;
+        }
+
+        // Same order as FindPathPlatformer, split so only graph routes are
+        // cached: grid fallbacks have no revision to validate them against.
+        result.clear();
+        uint64_t revision = 0;
+        bool onGraph = false;
+        try {
+            const NavGraph* graph = searchMap->getNavGraph();
+            onGraph = graph && graph->findPath(query.start, query.goal, route, nullptr, &revision);
+            if (onGraph) {
+                for (const NavWaypoint& waypoint : route) {
+                    result.push_back(waypoint.position);
+                }
+            } else {
+                FindPathHierarchical(*searchMap, query.start, query.goal, result, GridSearch::JUMP_POINT);
+            }
+        } catch (const std::exception& e) {
+            printf("[PathfindingService] Query failed: %s\n", e.what());
+            result.clear();
+            onGraph = false;
+        }
+        deliver(query, result, onGraph ? &route : nullptr, revision);
+    }
+}
+
+void PathfindingService::deliver(const Query& query, std::vector<Vector2>& result, const std::vector<NavWaypoint>* route, uint64_t revision) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Cached even when the requester has gone; its neighbours ask the same.
+    if (route && map && map->getNavGraph()) {
+        cache.insert(*map->getNavGraph(), query.start, query.goal, *route, revision);
+    }
+
+    Slot* slot = findSlot(query.handle);
+    if (!slot) return;
+    slot->running = false;
+    slot->mailbox.assign(result.begin(), result.end());
+    slot->delivered = true;
+}
+
+PathCacheStats PathfindingService::getCacheStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cache.getStats();
+}
+
+void PathfindingService::dumpStats() const {
+    PathCacheStats stats = getCacheStats();
+    uint64_t lookups = stats.hits + stats.misses;
+    printf("[PathfindingService] Cache %zu entries, %llu hits / %llu misses (%.1f%% hit), %llu stale, %llu evicted\n",
+           stats.entries,
+           static_cast<unsigned long long>(stats.hits),
+           static_cast<unsigned long long>(stats.misses),
+           lookups > 0 ? 100.0 * stats.hits / lookups : 0.0,
+           static_cast<unsigned long long>(stats.stale),
+           static_cast<unsigned long long>(stats.evictions));
+}
@@ -0,0 +1,111 @@
+#include "PlayerVisibility.hpp"
+#include "map/Map.hpp"
+#include "map/TileMask.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    int ToTile(float world) { return static_cast<int>(std::floor(world / 32.0f)); }
+}
+
+PlayerVisibility& PlayerVisibility::getInstance() {
+    static PlayerVisibility instance;
+    return instance;
+}
+
+PlayerVisibility::PlayerVisibility() {
+    for (auto& bits : visible) {
+        bits.assign(BITMAP_WORDS, 0);
+    }
+}
+
+void PlayerVisibility::setMap(const Map* newMap) {
+    map = newMap;
+    valid = false;
+}
+
+bool PlayerVisibility::blocks(int x, int y) const {
+    return fillBlocker == RayBlocker::OPAQUE ? fillMask->isOpaque(x, y) : fillMask->isSolid(x, y);
+}
+
+void PlayerVisibility::markVisible(int x, int y) {
+    int index = (x - originX) * SIDE + (y - originY);
+    visible[static_cast<int>(fillBlocker)][index >> 6] |= uint64_t(1) << (index & 63);
+}
+
+void PlayerVisibility::update(Vector2 playerPosition) {
+    valid = false;
+    if (!map || !map->getTileMask()) return;
+
+    fillMask = map->getTileMask();
+    centerX = ToTile(playerPosition.x);
+    centerY = ToTile(playerPosition.y);
+    originX = centerX - RADIUS;
+    originY = centerY - RADIUS;
+
+    // Octant transforms from (column, row) to map offsets.
+    static constexpr Octant OCTANTS[8] = {
+        { 1, 0, 0, 1 }, { 0, 1, 1, 0 }, { 0, -1, 1, 0 }, { -1, 0, 0, 1 },
+        { -1, 0, 0, -1 }, { 0, -1, -1, 0 }, { 0, 1, -1, 0 }, { 1, 0, 0, -1 }
+    };
+
+    for (RayBlocker blocker : { RayBlocker::SOLID, RayBlocker::OPAQUE }) {
+        fillBlocker = blocker;
+        std::fill(visible[static_cast<int>(blocker)].begin(), visible[static_cast<int>(blocker)].end(), 0);
+        if (blocks(centerX, centerY)) continue;
+
+        markVisible(centerX, centerY);
+        for (const Octant& octant : OCTANTS) {
+            castLight(1, 1.0f, 0.0f, octant);
+        }
+    }
+    valid = true;
+}
+
+// Scans rows outward from the centre; slopes bound the lit wedge. A run of
+// blockers ends the wedge for farther rows and recurses on the part above it.
+void PlayerVisibility::castLight(int row, float startSlope, float endSlope, const Octant& octant) {
+    if (startSlope < endSlope) return;
+
+    float nextStart = startSlope;
+    for (int distance = row; distance <= RADIUS; ++distance) {
+        bool blocked = false;
+        int dy = -distance;
+        for (int dx = -distance; dx <= 0; ++dx) {
+            float leftSlope = (dx - 0.5f) / (dy + 0.5f);
+            float rightSlope = (dx + 0.5f) / (dy - 0.5f);
+            if (startSlope < rightSlope) continue;
+            if (endSlope > leftSlope) break;
+
+            int x = centerX + dx * octant.xx + dy * octant.xy;
+            int y = centerY + dx * octant.yx + dy * octant.yy;
+            bool wall = blocks(x, y);
+            if (!wall && dx * dx + dy * dy <= RADIUS * RADIUS) {
+                markVisible(x, y);
+            }
+
+            if (blocked) {
+                if (wall) {
+                    nextStart = rightSlope;
+                } else {
+                    blocked = false;
+                    startSlope = nextStart;
+                }
+            } else if (wall && distance < RADIUS) {
+                blocked = true;
+                castLight(distance + 1, startSlope, leftSlope, octant);
+                nextStart = rightSlope;
+            }
+        }
+        if (blocked) break;
+    }
+}
+
+bool PlayerVisibility::canSeePlayer(Vector2 position, RayBlocker blocker) const {
+    if (!valid) return false;
+    int lx = ToTile(position.x) - originX;
+    int ly = ToTile(position.y) - originY;
+    if (lx < 0 || ly < 0 || lx >= SIDE || ly >= SIDE) return false;
+    int index = lx * SIDE + ly;
+    return (visible[static_cast<int>(blocker)][index >> 6] >> (index & 63)) & 1u;
+}
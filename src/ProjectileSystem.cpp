@@ -0,0 +1,264 @@
+#include "ProjectileSystem.hpp"
+#include "CollisionGrid.hpp"
+#include "CombatResolver.hpp"
+#include "Player.hpp"
+#include "map/Map.hpp"
+#include "enemies/EnemyManager.hpp"
+#include "effects/ParticleSystem.hpp"
+#include <cmath>
+#include <utility>
+
+namespace {
+    // The part of the player projectiles can hit, relative to its position.
+    constexpr float PLAYER_HITBOX_OFFSET_X = 4.8f;
+    constexpr float PLAYER_HITBOX_OFFSET_Y = 3.0f;
+    constexpr float PLAYER_HITBOX_WIDTH = 33.6f;
+    constexpr float PLAYER_HITBOX_HEIGHT = 54.0f;
+
+    constexpr float TRAIL_INTERVAL = 0.05f;
+    constexpr int TRAIL_PARTICLES = 3;
+
+    constexpr float ARROW_DRAW_Y_OFFSET = -4.0f;
+    constexpr float ARROW_DRAW_WIDTH = 32.0f;
+    constexpr float ARROW_DRAW_HEIGHT = 8.0f;
+    constexpr float ARROW_DRAW_LINE_THICKNESS = 1.0f;
+
+    // Every hitbox is smaller than a tile, so any wall tile the moving box
+    // overlaps holds one of its corners at that moment: casting the four
+    // corners sweeps the whole box. The far corners sit just inside the box
+    // so one resting flush against a tile edge doesn't count as entering it.
+    constexpr size_t SWEEP_CORNERS = 4;
+    constexpr float CORNER_INSET = 0.01f;
+
+    // Sweeping a projectile's corner against target grown by the
+    // projectile's size is the same as sweeping the whole hitbox.
+    Rectangle GrowBy(const Rectangle& target, float width, float height) {
+        return { target.x - width, target.y - height, target.width + width, target.height + height };
+    }
+}
+
+ProjectileSystem& ProjectileSystem::getInstance() {
+    static ProjectileSystem instance;
+    return instance;
+}
+
+ProjectileSystem::ProjectileSystem()
+    : posX(CAPACITY), posY(CAPACITY),
+      prevX(CAPACITY), prevY(CAPACITY),
+      velX(CAPACITY), velY(CAPACITY),
+      width(CAPACITY), height(CAPACITY),
+      lifetime(CAPACITY),
+      trailTimer(CAPACITY),
+      damage(CAPACITY),
+      kind(CAPACITY),
+      faction(CAPACITY),
+      alive(CAPACITY),
+      owner(CAPACITY),
+      trailColor(CAPACITY) {
+    sweeps.reserve(CAPACITY * SWEEP_CORNERS);
+    tileHits.reserve(CAPACITY * SWEEP_CORNERS);
+}
+
+bool ProjectileSystem::spawn(const ProjectileSpawn& projectile) {
+    if (count >= CAPACITY) return false;
+
+    size_t i = count++;
+    posX[i] = prevX[i] = projectile.position.x;
+    posY[i] = prevY[i] = projectile.position.y;
+    velX[i] = projectile.velocity.x;
+    velY[i] = projectile.velocity.y;
+    width[i] = projectile.size.x;
+    height[i] = projectile.size.y;
+    lifetime[i] = projectile.lifetime;
+    trailTimer[i] = 0.0f;
+    damage[i] = projectile.damage;
+    kind[i] = projectile.kind;
+    faction[i] = projectile.faction;
+    alive[i] = 1;
+    owner[i] = projectile.owner;
+    trailColor[i] = projectile.trailColor;
+    return true;
+}
+
+void ProjectileSystem::clear() {
+    count = 0;
+}
+
+void ProjectileSystem::update(float dt, const Map& map, EnemyManager& enemyManager, const Player& player) {
+    if (count == 0) return;
+
+    for (size_t i = 0; i < count; ++i) {
+        prevX[i] = posX[i];
+        prevY[i] = posY[i];
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        lifetime[i] -= dt;
+    }
+
+    // A projectile that reaches a wall stops there, but still hits anything
+    // it passed on the way; it is removed below with the expired ones.
+    if (const Raycaster* raycaster = map.getRaycaster()) {
+        size_t rays = count * SWEEP_CORNERS;
+        sweeps.resize(rays);
+        tileHits.resize(rays);
+        for (size_t i = 0; i < count; ++i) {
+            float right = width[i] - CORNER_INSET;
+            float bottom = height[i] - CORNER_INSET;
+            const float corners[SWEEP_CORNERS][2] = { { 0.0f, 0.0f }, { right, 0.0f }, { 0.0f, bottom }, { right, bottom } };
+            for (size_t c = 0; c < SWEEP_CORNERS; ++c) {
+                sweeps[i * SWEEP_CORNERS + c] = {
+                    { prevX[i] + corners[c][0], prevY[i] + corners[c][1] },
+                    { posX[i] + corners[c][0], posY[i] + corners[c][1] }
+                };
+            }
+        }
+        raycaster->raycastBatch(sweeps.data(), rays, tileHits.data(), RayBlocker::SOLID);
+        for (size_t i = 0; i < count; ++i) {
+            // The corner that reaches a wall first stops the whole box.
+            float nearest = -1.0f;
+            for (size_t c = 0; c < SWEEP_CORNERS; ++c) {
+                const RayHit& hit = tileHits[i * SWEEP_CORNERS + c];
+                if (hit.hit && (nearest < 0.0f || hit.distance < nearest)) nearest = hit.distance;
+            }
+            if (nearest < 0.0f) continue;
+            float stepX = posX[i] - prevX[i];
+            float stepY = posY[i] - prevY[i];
+            float length = sqrtf(stepX * stepX + stepY * stepY);
+            float fraction = length > 0.0f ? nearest / length : 0.0f;
+            posX[i] = prevX[i] + stepX * fraction;
+            posY[i] = prevY[i] + stepY * fraction;
+            lifetime[i] = 0.0f;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (faction[i] == Faction::PLAYER) {
+            hitEnemies(i, enemyManager);
+        } else {
+            hitPlayer(i, player);
+        }
+    }
+
+    ParticleSystem& particles = ParticleSystem::getInstance();
+    for (size_t i = 0; i < count; ++i) {
+        if (!alive[i] || lifetime[i] <= 0.0f || kind[i] != ProjectileKind::ARROW) continue;
+        trailTimer[i] += dt;
+        if (trailTimer[i] >= TRAIL_INTERVAL) {
+            particles.createExplosionParticles({ posX[i], posY[i] }, TRAIL_PARTICLES, trailColor[i]);
+            trailTimer[i] = 0.0f;
+        }
+    }
+
+    // Backwards, so the projectile swapped into a hole has already been checked.
+    for (size_t i = count; i-- > 0;) {
+        if (!alive[i] || lifetime[i] <= 0.0f) {
+            removeAt(i);
+        }
+    }
+}
+
+void ProjectileSystem::hitEnemies(size_t i, EnemyManager& enemyManager) {
+    const CollisionGrid& grid = CollisionGrid::getInstance();
+    Vector2 from = { prevX[i], prevY[i] };
+    Vector2 to = { posX[i], posY[i] };
+    candidates.clear();
+    grid.querySegment(from, to, ColliderMask::ENEMY, candidates);
+
+    EnemyHandle nearest;
+    float nearestT = 2.0f;
+    for (ColliderId id : candidates) {
+        EnemyHandle handle = grid.get(id).enemy;
+        Enemy* enemy = enemyManager.getEnemy(handle);
+        if (!enemy || !enemy->isAlive()) continue;
+
+        Rectangle hitbox = enemy->getHitbox();
+        if (enemy->getType() == EnemyType::SCRAP_HOUND) {
+            hitbox = static_cast<ScrapHound*>(enemy)->getArrowHitbox();
+        }
+        float t;
+        if (SegmentEntersRect(from, to, GrowBy(hitbox, width[i], height[i]), t) && t < nearestT) {
+            nearest = handle;
+            nearestT = t;
+        }
+    }
+
+    if (nearest.isValid()) {
+        HitCandidate hit;
+        hit.source = HitSource::PROJECTILE;
+        hit.target = nearest;
+        hit.sourceId = static_cast<uint32_t>(i);
+        hit.damage = damage[i];
+        CombatResolver::getInstance().submit(hit);
+        alive[i] = 0;
+    }
+}
+
+void ProjectileSystem::hitPlayer(size_t i, const Player& player) {
+    // Invulnerable players let shots pass through.
+    if (!player.canTakeDamage()) return;
+
+    const CollisionGrid& grid = CollisionGrid::getInstance();
+    Vector2 from = { prevX[i], prevY[i] };
+    Vector2 to = { posX[i], posY[i] };
+    candidates.clear();
+    grid.querySegment(from, to, ColliderMask::PLAYER, candidates);
+    if (candidates.empty()) return;
+
+    Vector2 playerPos = player.getPosition();
+    Rectangle playerHitbox = {
+        playerPos.x + PLAYER_HITBOX_OFFSET_X,
+        playerPos.y + PLAYER_HITBOX_OFFSET_Y,
+        PLAYER_HITBOX_WIDTH,
+        PLAYER_HITBOX_HEIGHT
+    };
+    float t;
+    if (!SegmentEntersRect(from, to, GrowBy(playerHitbox, width[i], height[i]), t)) return;
+
+    HitCandidate hit;
+    hit.source = HitSource::PROJECTILE;
+    hit.sourceId = static_cast<uint32_t>(i);
+    hit.damage = damage[i];
+    if (kind[i] == ProjectileKind::AUTOMATON_SHOT) {
+        hit.shakeIntensity = 0.4f;
+        hit.shakeDuration = 0.25f;
+    }
+    CombatResolver::getInstance().submit(hit);
+    alive[i] = 0;
+}
+
+void ProjectileSystem::removeAt(size_t i) {
+    size_t last = --count;
+    if (i == last) return;
+    posX[i] = posX[last];
+    posY[i] = posY[last];
+    prevX[i] = prevX[last];
+    prevY[i] = prevY[last];
+    velX[i] = velX[last];
+    velY[i] = velY[last];
+    width[i] = width[last];
+    height[i] = height[last];
+    lifetime[i] = lifetime[last];
+    trailTimer[i] = trailTimer[last];
+    damage[i] = damage[last];
+    kind[i] = kind[last];
+    faction[i] = faction[last];
+    alive[i] = alive[last];
+    owner[i] = owner[last];
+    trailColor[i] = trailColor[last];
+}
+
+void ProjectileSystem::draw() const {
+    for (size_t i = 0; i < count; ++i) {
+        switch (kind[i]) {
+            case ProjectileKind::ARROW: {
+                Rectangle arrowRect = { posX[i], posY[i] + ARROW_DRAW_Y_OFFSET, ARROW_DRAW_WIDTH, ARROW_DRAW_HEIGHT };
+                DrawRectangleRec(arrowRect, GREEN);
+                DrawRectangleLinesEx(arrowRect, ARROW_DRAW_LINE_THICKNESS, DARKGREEN);
+                break;
+            }
+            case ProjectileKind::AUTOMATON_SHOT:
+                DrawCircle(static_cast<int>(posX[i] + width[i] / 2), static_cast<int>(posY[i] + height[i] / 2), width[i] / 2, RED);
+                break;
+        }
+    }
+}
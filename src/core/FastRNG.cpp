@@ -48,7 +48,65 @@ int FastRNG::rollPercent() {
 }
 
 float FastRNG::nextFloat() {
-    return static_cast<float>(next() >> 11) * 0x1.0p-53f;
+    // 24 bits is all a float mantissa holds; more can round up to 1.0f.
+    return static_cast<float>(next() >> 40) * 0x1.0p-24f;
+}
+
+float FastRNG::nextFloat(float lo, float hi) {
+    return lo + nextFloat() * (hi - lo);
+}
+
+void FastRNG::fillFloats(float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        uint64_t bits = next();
+        out[i] = static_cast<float>(bits >> 40) * 0x1.0p-24f;
+        out[i + 1] = static_cast<float>((bits >> 8) & 0xFFFFFF) * 0x1.0p-24f;
+    }
+    if (i < count) {
+        out[i] = nextFloat();
+    }
+}
+
+void FastRNG::fillFloats(float* out, size_t count, float lo, float hi) {
+    fillFloats(out, count);
+    float range = hi - lo;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = lo + out[i] * range;
+    }
+}
+
+void FastRNG::applyJump(const uint64_t (&polynomial)[4]) {
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (uint64_t word : polynomial) {
+        for (int b = 0; b < 64; ++b) {
+            if (word & (uint64_t(1) << b)) {
+                s0 ^= state[0];
+                s1 ^= state[1];
+                s2 ^= state[2];
+                s3 ^= state[3];
+            }
+            next();
+        }
+    }
+    state[0] = s0;
+    state[1] = s1;
+    state[2] = s2;
+    state[3] = s3;
+}
+
+void FastRNG::jump() {
+    static const uint64_t JUMP[4] = {
+        0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c
+    };
+    applyJump(JUMP);
+}
+
+void FastRNG::longJump() {
+    static const uint64_t LONG_JUMP[4] = {
+        0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635
+    };
+    applyJump(LONG_JUMP);
 }
 
 uint64_t FastRNG::rotl(const uint64_t x, int k) {
@@ -280,6 +280,7 @@ void InputManager::setupDefaultBindings() {
     // Debug/Development
     bindKey(InputAction::QUICK_SAVE, KEY_F5);
     bindKey(InputAction::QUICK_LOAD, KEY_F9);
+    bindKey(InputAction::DEBUG_BENCHMARK, KEY_F8);
 
     // Gamepad bindings
     bindGamepadButton(InputAction::JUMP, GAMEPAD_BUTTON_RIGHT_FACE_DOWN); 
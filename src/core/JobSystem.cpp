@@ -0,0 +1,338 @@
+#include "core/JobSystem.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+JobSystem& JobSystem::getInstance() {
+    static JobSystem instance;
+    return instance;
+}
+
+namespace {
+    // Single writer per counter, so a plain load/store avoids a locked RMW.
+    inline void bump(std::atomic<uint64_t>& counter, uint64_t amount = 1) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    inline size_t histogramBucket(uint64_t ns) {
+        uint64_t us = ns / 1000;
+        size_t bucket = 0;
+        while (us != 0 && bucket < JobHistogram::BUCKETS - 1) {
+            us >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+}
+
+uint64_t JobHistogram::total() const {
+    uint64_t sum = 0;
+    for (uint64_t c : counts) sum += c;
+    return sum;
+}
+
+float JobHistogram::percentileUs(float p) const {
+    uint64_t all = total();
+    if (all == 0) return 0.0f;
+    uint64_t target = static_cast<uint64_t>(p * static_cast<float>(all));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        seen += counts[i];
+        if (seen > target) return static_cast<float>(1u << i);
+    }
+    return static_cast<float>(1u << (BUCKETS - 1));
+}
+
+JobSystem::JobSystem() : mainThreadId(std::this_thread::get_id()) {
+    size_t numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 4;
+    // Nested waits (map generation blocking on its own chunks) need at least
+    // one free worker, so never go below two.
+    numThreads = std::max(static_cast<size_t>(2), numThreads - 1);
+
+    counters.reset(new ThreadCounters[numThreads + 1]());
+    mainCounterIndex = numThreads;
+    startTime = Clock::now();
+    lastStatsDump = startTime;
+
+    workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+    printf("[JobSystem] Started %zu workers\n", numThreads);
+}
+
+JobSystem::~JobSystem() {
+    shutdown();
+}
+
+void JobSystem::push(JobPriority priority, std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (shutdownFlag.load(std::memory_order_acquire)) {
+            throw std::runtime_error("submit on stopped JobSystem");
+        }
+        size_t index = static_cast<size_t>(priority);
+        queues[index].push_back({std::move(job), Clock::now()});
+
+        size_t depth = queues[index].size();
+        queueDepth[index].store(depth, std::memory_order_relaxed);
+        if (depth > queueDepthHighWater[index].load(std::memory_order_relaxed)) {
+            queueDepthHighWater[index].store(depth, std::memory_order_relaxed);
+        }
+    }
+    condition.notify_one();
+}
+
+size_t ParallelRange::run() {
+    size_t slices = 0;
+    for (;;) {
+        size_t begin = next.fetch_add(grain, std::memory_order_relaxed);
+        if (begin >= end) return slices;
+        ++slices;
+        if (failed.load(std::memory_order_relaxed)) continue;
+        try {
+            invoke(ctx, begin, std::min(begin + grain, end));
+        } catch (...) {
+            if (!failed.exchange(true, std::memory_order_acq_rel)) {
+                error = std::current_exception();
+            }
+        }
+    }
+}
+
+void JobSystem::removeParallelRange(ParallelRange* range) {
+    for (size_t i = 0; i < parallelRangeCount; ++i) {
+        if (parallelRanges[i] == range) {
+            for (size_t j = i + 1; j < parallelRangeCount; ++j) {
+                parallelRanges[j - 1] = parallelRanges[j];
+            }
+            --parallelRangeCount;
+            return;
+        }
+    }
+}
+
+void JobSystem::runParallel(ParallelRange& range, size_t maxHelpers) {
+    bool published = false;
+    if (maxHelpers > 0 && !shutdownFlag.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (parallelRangeCount < MAX_PARALLEL_RANGES) {
+            range.helpersWanted = static_cast<int>(std::min(maxHelpers, workers.size()));
+            parallelRanges[parallelRangeCount++] = &range;
+            published = true;
+        }
+    }
+    if (published) {
+        if (maxHelpers == 1) {
+            condition.notify_one();
+        } else {
+            condition.notify_all();
+        }
+    }
+
+    range.run();
+
+    if (published) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            removeParallelRange(&range);
+        }
+        // Helpers that already joined are finishing their last slice.
+        while (range.activeHelpers.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (range.failed.load(std::memory_order_acquire) && range.error) {
+        std::rethrow_exception(range.error);
+    }
+}
+
+void JobSystem::runCounted(QueuedJob& job, ThreadCounters& threadCounters) {
+    auto startedAt = Clock::now();
+    try {
+        job.fn();
+    } catch (const std::exception& e) {
+        printf("[JobSystem] Job threw: %s\n", e.what());
+    } catch (...) {
+        printf("[JobSystem] Job threw an unknown exception\n");
+    }
+    auto finishedAt = Clock::now();
+
+    uint64_t waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(startedAt - job.enqueuedAt).count();
+    uint64_t runNs = std::chrono::duration_cast<std::chrono::nanoseconds>(finishedAt - startedAt).count();
+    bump(threadCounters.tasksExecuted);
+    bump(threadCounters.busyNs, runNs);
+    bump(threadCounters.queueLatency[histogramBucket(waitNs)]);
+    bump(threadCounters.execTime[histogramBucket(runNs)]);
+}
+
+void JobSystem::workerLoop(size_t index) {
+    ThreadCounters& threadCounters = counters[index];
+    for (;;) {
+        QueuedJob job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            condition.wait(lock, [this] {
+                if (shutdownFlag.load(std::memory_order_acquire)) return true;
+                if (parallelRangeCount > 0) return true;
+                for (const auto& q : queues) {
+                    if (!q.empty()) return true;
+                }
+                return false;
+            });
+
+            if (parallelRangeCount > 0) {
+                ParallelRange* range = parallelRanges[0];
+                range->activeHelpers.fetch_add(1, std::memory_order_relaxed);
+                if (--range->helpersWanted <= 0) {
+                    removeParallelRange(range);
+                }
+                lock.unlock();
+
+                bump(threadCounters.stealAttempts);
+                if (range->run() > 0) {
+                    bump(threadCounters.stealSuccesses);
+                }
+                range->activeHelpers.fetch_sub(1, std::memory_order_release);
+                continue;
+            }
+
+            for (size_t p = 0; p < queues.size(); ++p) {
+                if (!queues[p].empty()) {
+                    job = std::move(queues[p].front());
+                    queues[p].pop_front();
+                    queueDepth[p].store(queues[p].size(), std::memory_order_relaxed);
+                    break;
+                }
+            }
+            if (!job.fn) {
+                return;
+            }
+            ++activeJobs;
+        }
+
+        runCounted(job, threadCounters);
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            --activeJobs;
+        }
+        finished.notify_all();
+    }
+}
+
+void JobSystem::runOnMainThread(std::function<void()> job) {
+    std::lock_guard<std::mutex> lock(mainThreadMutex);
+    mainThreadJobs.push_back({std::move(job), Clock::now()});
+}
+
+size_t JobSystem::processMainThreadJobs(float budgetMs) {
+    auto start = Clock::now();
+    size_t processed = 0;
+
+    if (statsDumpInterval > 0.0f &&
+        std::chrono::duration<float>(start - lastStatsDump).count() >= statsDumpInterval) {
+        lastStatsDump = start;
+        dumpStats();
+    }
+
+    ThreadCounters& mainCounters = counters[mainCounterIndex];
+    for (;;) {
+        QueuedJob job;
+        {
+            std::lock_guard<std::mutex> lock(mainThreadMutex);
+            if (mainThreadJobs.empty()) break;
+            job = std::move(mainThreadJobs.front());
+            mainThreadJobs.pop_front();
+        }
+
+        runCounted(job, mainCounters);
+        ++processed;
+
+        float elapsedMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        if (elapsedMs >= budgetMs) break;
+    }
+    return processed;
+}
+
+JobSystemStats::Thread JobSystem::readCounters(const ThreadCounters& threadCounters) {
+    JobSystemStats::Thread thread;
+    thread.tasksExecuted = threadCounters.tasksExecuted.load(std::memory_order_relaxed);
+    thread.stealAttempts = threadCounters.stealAttempts.load(std::memory_order_relaxed);
+    thread.stealSuccesses = threadCounters.stealSuccesses.load(std::memory_order_relaxed);
+    thread.busyMs = threadCounters.busyNs.load(std::memory_order_relaxed) / 1e6;
+    for (size_t i = 0; i < JobHistogram::BUCKETS; ++i) {
+        thread.queueLatency.counts[i] = threadCounters.queueLatency[i].load(std::memory_order_relaxed);
+        thread.execTime.counts[i] = threadCounters.execTime[i].load(std::memory_order_relaxed);
+    }
+    return thread;
+}
+
+JobSystemStats JobSystem::getStats() const {
+    JobSystemStats stats;
+    stats.workers.reserve(mainCounterIndex);
+    for (size_t i = 0; i < mainCounterIndex; ++i) {
+        stats.workers.push_back(readCounters(counters[i]));
+    }
+    stats.mainThread = readCounters(counters[mainCounterIndex]);
+    for (size_t p = 0; p < queues.size(); ++p) {
+        stats.queueDepth[p] = queueDepth[p].load(std::memory_order_relaxed);
+        stats.queueDepthHighWater[p] = queueDepthHighWater[p].load(std::memory_order_relaxed);
+    }
+    stats.uptimeSeconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+    return stats;
+}
+
+void JobSystem::dumpStats() const {
+    JobSystemStats stats = getStats();
+    double uptimeMs = stats.uptimeSeconds * 1000.0;
+
+    printf("[JobSystem] Stats after %.1f s, queue depth now/high: critical %zu/%zu, streaming %zu/%zu, idle %zu/%zu\n",
+           stats.uptimeSeconds,
+           stats.queueDepth[0], stats.queueDepthHighWater[0],
+           stats.queueDepth[1], stats.queueDepthHighWater[1],
+           stats.queueDepth[2], stats.queueDepthHighWater[2]);
+
+    auto printThread = [uptimeMs](const char* label, size_t index, const JobSystemStats::Thread& t) {
+        printf("[JobSystem]   %s %2zu: %8llu tasks, busy %5.1f%%, steals %llu/%llu, "
+               "wait p50 %.0f us p99 %.0f us, run p50 %.0f us p99 %.0f us\n",
+               label, index,
+               static_cast<unsigned long long>(t.tasksExecuted),
+               uptimeMs > 0.0 ? 100.0 * t.busyMs / uptimeMs : 0.0,
+               static_cast<unsigned long long>(t.stealSuccesses),
+               static_cast<unsigned long long>(t.stealAttempts),
+               t.queueLatency.percentileUs(0.5f), t.queueLatency.percentileUs(0.99f),
+               t.execTime.percentileUs(0.5f), t.execTime.percentileUs(0.99f));
+    };
+    for (size_t i = 0; i < stats.workers.size(); ++i) {
+        printThread("worker", i, stats.workers[i]);
+    }
+    printThread("main  ", 0, stats.mainThread);
+}
+
+void JobSystem::waitForAll() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    finished.wait(lock, [this] {
+        if (activeJobs != 0) return false;
+        for (const auto& q : queues) {
+            if (!q.empty()) return false;
+        }
+        return true;
+    });
+}
+
+void JobSystem::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (shutdownFlag.exchange(true, std::memory_order_acq_rel)) return;
+    }
+    condition.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+}
@@ -0,0 +1,191 @@
+#include "core/LongJob.hpp"
+#include <cstdio>
+
+LongJob::LongJob(const char* name, JobPriority priority, Affinity affinity)
+    : name(name), priority(priority), affinity(affinity) {
+}
+
+void LongJob::start(const std::shared_ptr<LongJob>& job) {
+    Status expected = Status::PENDING;
+    if (job->status.compare_exchange_strong(expected, Status::RUNNING, std::memory_order_acq_rel)) {
+        job->schedule();
+    }
+}
+
+bool LongJob::isFinished() const {
+    Status s = getStatus();
+    return s == Status::DONE || s == Status::CANCELLED || s == Status::FAILED;
+}
+
+void LongJob::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    finishedCondition.wait(lock, [this] { return isFinished(); });
+}
+
+void LongJob::cancel() {
+    cancelled.store(true, std::memory_order_release);
+
+    Status expected = Status::PENDING;
+    if (status.compare_exchange_strong(expected, Status::RUNNING, std::memory_order_acq_rel)) {
+        finish(Status::CANCELLED);
+        return;
+    }
+
+    std::shared_ptr<LongJob> child;
+    bool ownsChild;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        child = awaitedChild;
+        ownsChild = ownsAwaitedChild;
+    }
+    if (!child) return;
+
+    if (ownsChild) {
+        // The child finishing resumes us, and the next slice sees the flag.
+        child->cancel();
+    } else if (child->removeContinuation(this)) {
+        schedule();
+    }
+}
+
+void LongJob::throwIfCancelled() const {
+    if (isCancelled()) {
+        throw JobCancelled();
+    }
+}
+
+void LongJob::reportProgress(float fraction, const char* phaseName) {
+    progress.store(fraction, std::memory_order_relaxed);
+    if (phaseName) {
+        phase.store(phaseName, std::memory_order_relaxed);
+    }
+}
+
+void LongJob::awaitJob(const std::shared_ptr<LongJob>& child) {
+    std::lock_guard<std::mutex> lock(mutex);
+    pendingChild = child;
+}
+
+bool LongJob::addContinuation(const std::shared_ptr<LongJob>& parent) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (isFinished()) return false;
+    continuations.push_back(parent);
+    return true;
+}
+
+bool LongJob::removeContinuation(const LongJob* parent) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = continuations.begin(); it != continuations.end(); ++it) {
+        if (it->get() == parent) {
+            continuations.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void LongJob::schedule() {
+    auto self = shared_from_this();
+    auto& jobs = JobSystem::getInstance();
+
+    if (affinity == Affinity::MAIN_THREAD) {
+        jobs.runOnMainThread([self]() { self->runSlice(); });
+        return;
+    }
+
+    try {
+        jobs.submit(priority, [self]() { self->runSlice(); });
+    } catch (const std::runtime_error&) {
+        finish(Status::CANCELLED);
+    }
+}
+
+void LongJob::runSlice() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        awaitedChild.reset();
+        ownsAwaitedChild = false;
+    }
+
+    if (isCancelled()) {
+        finish(Status::CANCELLED);
+        return;
+    }
+    status.store(Status::RUNNING, std::memory_order_release);
+
+    Step step;
+    try {
+        step = resume();
+    } catch (const JobCancelled&) {
+        finish(Status::CANCELLED);
+        return;
+    } catch (const std::exception& e) {
+        printf("[LongJob] '%s' failed: %s\n", name, e.what());
+        finish(Status::FAILED);
+        return;
+    } catch (...) {
+        printf("[LongJob] '%s' failed with an unknown exception\n", name);
+        finish(Status::FAILED);
+        return;
+    }
+
+    if (step == Step::DONE) {
+        finish(Status::DONE);
+        return;
+    }
+    if (step == Step::YIELD) {
+        schedule();
+        return;
+    }
+
+    std::shared_ptr<LongJob> child;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        child = std::move(pendingChild);
+    }
+    if (!child) {
+        schedule();
+        return;
+    }
+
+    Status expected = Status::PENDING;
+    bool ownsChild = child->status.compare_exchange_strong(expected, Status::RUNNING, std::memory_order_acq_rel);
+
+    status.store(Status::WAITING, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        awaitedChild = child;
+        ownsAwaitedChild = ownsChild;
+    }
+
+    if (!child->addContinuation(shared_from_this())) {
+        schedule();
+        return;
+    }
+    if (ownsChild) {
+        child->schedule();
+    }
+
+    // A cancel that landed before awaitedChild was set could not reach the child.
+    if (isCancelled()) {
+        cancel();
+    }
+}
+
+void LongJob::finish(Status result) {
+    std::vector<std::shared_ptr<LongJob>> resumeNext;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (result == Status::DONE) {
+            progress.store(1.0f, std::memory_order_relaxed);
+        }
+        status.store(result, std::memory_order_release);
+        resumeNext = std::move(continuations);
+        continuations.clear();
+    }
+    finishedCondition.notify_all();
+
+    for (auto& parent : resumeNext) {
+        parent->schedule();
+    }
+}
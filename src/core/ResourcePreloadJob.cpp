@@ -0,0 +1,56 @@
+#include "core/ResourcePreloadJob.hpp"
+#include "core/Core.hpp"
+#include <cstdio>
+
+namespace Core {
+
+ResourcePreloadJob::ResourcePreloadJob(std::vector<std::string> texturePaths,
+                                       std::vector<std::string> soundPaths,
+                                       std::vector<std::string> musicPaths)
+    : LongJob("ResourcePreload", JobPriority::STREAMING, Affinity::MAIN_THREAD),
+      texturePaths(std::move(texturePaths)),
+      soundPaths(std::move(soundPaths)),
+      musicPaths(std::move(musicPaths)) {
+    textures.reserve(this->texturePaths.size());
+}
+
+LongJob::Step ResourcePreloadJob::resume() {
+    auto& resourceManager = GetResourceManager();
+    size_t total = texturePaths.size() + soundPaths.size() + musicPaths.size();
+
+    switch (state) {
+    case TEXTURES:
+        if (nextIndex < texturePaths.size()) {
+            auto handle = resourceManager.loadTexture(texturePaths[nextIndex++]);
+            if (handle.isValid()) {
+                textures.push_back(handle);
+            }
+            break;
+        }
+        state = SOUNDS;
+        nextIndex = 0;
+        [[fallthrough]];
+    case SOUNDS:
+        if (nextIndex < soundPaths.size()) {
+            resourceManager.loadSound(soundPaths[nextIndex++]);
+            break;
+        }
+        state = MUSIC;
+        nextIndex = 0;
+        [[fallthrough]];
+    case MUSIC:
+        if (nextIndex < musicPaths.size()) {
+            resourceManager.loadMusic(musicPaths[nextIndex++]);
+            break;
+        }
+        printf("[ResourceManager] Preloaded %zu resources\n", loadedCount);
+        return Step::DONE;
+    }
+
+    ++loadedCount;
+    static const char* const phaseNames[] = { "Loading textures", "Loading sounds", "Loading music" };
+    reportProgress(total > 0 ? static_cast<float>(loadedCount) / total : 1.0f, phaseNames[state]);
+    return Step::YIELD;
+}
+
+}
@@ -0,0 +1,75 @@
+#include "core/RngService.hpp"
+#include <chrono>
+#include <cstdio>
+
+RngService& RngService::getInstance() {
+    static RngService instance;
+    return instance;
+}
+
+RngService::RngService() {
+    setRunSeed(0);
+}
+
+void RngService::setRunSeed(uint64_t seed) {
+    if (seed == 0) {
+        seed = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // Even long jumps are the deterministic streams, odd ones seed the
+    // per-thread streams of the same subsystem.
+    FastRNG root(seed);
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        subsystemBase[i] = root;
+        root.longJump();
+        threadBase[i] = root;
+        root.longJump();
+    }
+    runSeed.store(seed, std::memory_order_release);
+    generation.fetch_add(1, std::memory_order_acq_rel);
+    printf("[RNG] Run seed %llu\n", static_cast<unsigned long long>(seed));
+}
+
+FastRNG RngService::stream(RngStream id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return subsystemBase[static_cast<size_t>(id)];
+}
+
+void RngService::split(RngStream id, size_t count, std::vector<FastRNG>& out) const {
+    FastRNG rng = stream(id);
+    out.clear();
+    out.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        rng.jump();
+        out.push_back(rng);
+    }
+}
+
+FastRNG& RngService::local(RngStream id) {
+    struct ThreadStreams {
+        uint32_t generation = 0;
+        uint32_t slot = 0;
+        bool hasSlot = false;
+        std::array<FastRNG, STREAM_COUNT> streams;
+    };
+    thread_local ThreadStreams threadStreams;
+
+    uint32_t current = generation.load(std::memory_order_acquire);
+    if (threadStreams.generation != current) {
+        if (!threadStreams.hasSlot) {
+            threadStreams.slot = nextThreadSlot.fetch_add(1, std::memory_order_relaxed);
+            threadStreams.hasSlot = true;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < STREAM_COUNT; ++i) {
+            FastRNG rng = threadBase[i];
+            for (uint32_t j = 0; j <= threadStreams.slot; ++j) {
+                rng.jump();
+            }
+            threadStreams.streams[i] = rng;
+        }
+        threadStreams.generation = current;
+    }
+    return threadStreams.streams[static_cast<size_t>(id)];
+}
@@ -0,0 +1,184 @@
+#include "core/TaskGraph.hpp"
+#include "core/JobSystem.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+
+int TaskGraph::addTask(const char* name, TaskResourceMask reads, TaskResourceMask writes, TaskFn fn, bool mainThreadOnly) {
+    Task task;
+    task.name = name;
+    task.reads = reads;
+    task.writes = writes;
+    task.fn = std::move(fn);
+    task.mainThreadOnly = mainThreadOnly;
+    tasks.push_back(std::move(task));
+    dirty = true;
+    return static_cast<int>(tasks.size()) - 1;
+}
+
+void TaskGraph::clear() {
+    tasks.clear();
+    criticalPath.clear();
+    dirty = true;
+}
+
+void TaskGraph::build() {
+    for (auto& task : tasks) {
+        task.successors.clear();
+        task.dependencyCount = 0;
+    }
+
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        for (size_t j = i + 1; j < tasks.size(); ++j) {
+            const Task& a = tasks[i];
+            const Task& b = tasks[j];
+            bool conflict = (a.writes & (b.reads | b.writes)) != 0 || (a.reads & b.writes) != 0;
+            if (conflict) {
+                tasks[i].successors.push_back(static_cast<int>(j));
+                tasks[j].dependencyCount++;
+            }
+        }
+    }
+
+    pending = std::make_unique<std::atomic<int>[]>(tasks.size());
+    readyTasks.reserve(tasks.size());
+    mainReadyTasks.reserve(tasks.size());
+    criticalPath.reserve(tasks.size());
+    dirty = false;
+}
+
+float TaskGraph::msSinceFrameStart() const {
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+}
+
+void TaskGraph::dispatch(int index) {
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        if (tasks[index].mainThreadOnly) {
+            mainReadyTasks.push_back(index);
+        } else {
+            readyTasks.push_back(index);
+        }
+    }
+    readyCondition.notify_all();
+
+    if (!tasks[index].mainThreadOnly && !JobSystem::getInstance().isShutdown()) {
+        // Posted, not submitted: nobody waits on the job, and a future per
+        // ready task would put a few heap allocations on every tick.
+        JobSystem::getInstance().post(JobPriority::FRAME_CRITICAL, [this]() { runOneReady(); });
+    }
+}
+
+void TaskGraph::runOneReady() {
+    int index;
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        if (readyTasks.empty()) return;
+        index = readyTasks.back();
+        readyTasks.pop_back();
+    }
+    runTask(index);
+}
+
+void TaskGraph::runTask(int index) {
+    Task& task = tasks[index];
+    task.startMs = msSinceFrameStart();
+    try {
+        task.fn();
+    } catch (const std::exception& e) {
+        printf("[TaskGraph] Task '%s' threw: %s\n", task.name, e.what());
+    } catch (...) {
+        printf("[TaskGraph] Task '%s' threw an unknown exception\n", task.name);
+    }
+    task.endMs = msSinceFrameStart();
+
+    for (int successor : task.successors) {
+        if (pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            tasks[successor].readyBy = index;
+            dispatch(successor);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        ++completedTasks;
+    }
+    readyCondition.notify_all();
+}
+
+void TaskGraph::execute() {
+    if (tasks.empty()) return;
+    if (dirty) build();
+
+    frameStart = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        readyTasks.clear();
+        mainReadyTasks.clear();
+        completedTasks = 0;
+    }
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        pending[i].store(tasks[i].dependencyCount, std::memory_order_relaxed);
+        tasks[i].readyBy = -1;
+    }
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (tasks[i].dependencyCount == 0) {
+            dispatch(static_cast<int>(i));
+        }
+    }
+
+    for (;;) {
+        int index = -1;
+        {
+            std::unique_lock<std::mutex> lock(readyMutex);
+            readyCondition.wait(lock, [this] {
+                return completedTasks == tasks.size() || !mainReadyTasks.empty() || !readyTasks.empty();
+            });
+            if (completedTasks == tasks.size()) break;
+
+            if (!mainReadyTasks.empty()) {
+                index = mainReadyTasks.back();
+                mainReadyTasks.pop_back();
+            } else {
+                index = readyTasks.back();
+                readyTasks.pop_back();
+            }
+        }
+        runTask(index);
+    }
+
+    lastFrameMs = msSinceFrameStart();
+    recordCriticalPath();
+}
+
+void TaskGraph::recordCriticalPath() {
+    criticalPath.clear();
+
+    int last = 0;
+    for (size_t i = 1; i < tasks.size(); ++i) {
+        if (tasks[i].endMs > tasks[last].endMs) last = static_cast<int>(i);
+    }
+
+    // readyBy is the predecessor that finished last, i.e. the one the task
+    // was actually waiting on.
+    for (int i = last; i >= 0; i = tasks[i].readyBy) {
+        const Task& task = tasks[i];
+        criticalPath.push_back({task.name, task.startMs, task.endMs - task.startMs});
+    }
+    std::reverse(criticalPath.begin(), criticalPath.end());
+}
+
+float TaskGraph::getCriticalPathMs() const {
+    float total = 0.0f;
+    for (const auto& timing : criticalPath) {
+        total += timing.durationMs;
+    }
+    return total;
+}
+
+void TaskGraph::printCriticalPath() const {
+    printf("[TaskGraph] Tick %.3f ms, critical path %.3f ms:\n", lastFrameMs, getCriticalPathMs());
+    for (const auto& timing : criticalPath) {
+        printf("[TaskGraph]   %-16s start %7.3f ms  took %7.3f ms\n", timing.name, timing.startMs, timing.durationMs);
+    }
+}
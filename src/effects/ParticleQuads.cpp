@@ -0,0 +1,59 @@
+#include "effects/ParticleQuads.hpp"
+#include "effects/ParticleSystem.hpp"
+#include <algorithm>
+#include <cstring>
+
+size_t buildParticleQuads(const ParticleStreams& particles, Rectangle view, ParticleLayer layer,
+                          float* positions, unsigned char* colors, size_t maxQuads) {
+    float right = view.x + view.width;
+    float bottom = view.y + view.height;
+    bool behind = layer == ParticleLayer::BEHIND_ACTORS;
+    size_t quads = 0;
+
+    for (size_t i = 0; i < particles.size() && quads < maxQuads; ++i) {
+        if ((particles.priority[i] == ParticlePriority::AMBIENT) != behind) continue;
+        float x = particles.px[i];
+        float y = particles.py[i];
+        float r = particles.radius[i];
+        if (x + r < view.x || x - r > right || y + r < view.y || y - r > bottom) continue;
+
+        float left = x - r;
+        float top = y - r;
+        float rightEdge = x + r;
+        float bottomEdge = y + r;
+
+        // Same corner order raylib uses for quads: TL, BL, BR / TL, BR, TR.
+        float* p = positions + quads * 18;
+        const float corners[6][2] = {
+            { left, top }, { left, bottomEdge }, { rightEdge, bottomEdge },
+            { left, top }, { rightEdge, bottomEdge }, { rightEdge, top }
+        };
+        for (int v = 0; v < 6; ++v) {
+            p[v * 3 + 0] = corners[v][0];
+            p[v * 3 + 1] = corners[v][1];
+            p[v * 3 + 2] = 0.0f;
+        }
+
+        Color color = particles.color[i];
+        unsigned char alpha = (unsigned char)(255.0f * std::min(1.0f, std::max(0.0f, particles.alpha[i])));
+        unsigned char* c = colors + quads * 24;
+        for (int v = 0; v < 6; ++v) {
+            c[v * 4 + 0] = color.r;
+            c[v * 4 + 1] = color.g;
+            c[v * 4 + 2] = color.b;
+            c[v * 4 + 3] = alpha;
+        }
+        ++quads;
+    }
+    return quads;
+}
+
+void fillParticleQuadTexcoords(float* texcoords, size_t quads) {
+    const float uv[12] = {
+        0.0f, 0.0f,  0.0f, 1.0f,  1.0f, 1.0f,
+        0.0f, 0.0f,  1.0f, 1.0f,  1.0f, 0.0f
+    };
+    for (size_t q = 0; q < quads; ++q) {
+        std::memcpy(texcoords + q * 12, uv, sizeof(uv));
+    }
+}
@@ -0,0 +1,69 @@
+#include "effects/ParticleRenderer.hpp"
+#include "effects/ParticleSystem.hpp"
+#include <raymath.h>
+#include <rlgl.h>
+#include <algorithm>
+
+void ParticleRenderer::ensureCapacity(size_t quads) {
+    if (loaded && quads <= capacityQuads) return;
+
+    size_t newCapacity = std::max(capacityQuads, INITIAL_QUADS);
+    while (newCapacity < quads) newCapacity *= 2;
+    newCapacity = std::min(newCapacity, ParticleSystem::MAX_PARTICLES);
+
+    if (!loaded) {
+        Image sprite = GenImageColor(SPRITE_SIZE, SPRITE_SIZE, BLANK);
+        ImageDrawCircle(&sprite, SPRITE_SIZE / 2, SPRITE_SIZE / 2, SPRITE_SIZE / 2 - 1, WHITE);
+        Texture2D texture = LoadTextureFromImage(sprite);
+        UnloadImage(sprite);
+        SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+
+        material = LoadMaterialDefault();
+        material.maps[MATERIAL_MAP_DIFFUSE].texture = texture;
+        loaded = true;
+    } else {
+        UnloadMesh(mesh);
+    }
+
+    mesh = {};
+    mesh.vertexCount = static_cast<int>(newCapacity * 6);
+    mesh.triangleCount = static_cast<int>(newCapacity * 2);
+    mesh.vertices = static_cast<float*>(MemAlloc(mesh.vertexCount * 3 * sizeof(float)));
+    mesh.texcoords = static_cast<float*>(MemAlloc(mesh.vertexCount * 2 * sizeof(float)));
+    mesh.colors = static_cast<unsigned char*>(MemAlloc(mesh.vertexCount * 4));
+    fillParticleQuadTexcoords(mesh.texcoords, newCapacity);
+    UploadMesh(&mesh, true);
+    capacityQuads = newCapacity;
+}
+
+void ParticleRenderer::draw(const ParticleStreams& particles, Rectangle view, ParticleLayer layer) {
+    if (particles.empty()) return;
+    ensureCapacity(particles.size());
+
+    // The second layer rewrites the buffer the first one drew from; GL
+    // orders the update after that draw, so one mesh serves both.
+    size_t quads = buildParticleQuads(particles, view, layer, mesh.vertices, mesh.colors, capacityQuads);
+    if (quads == 0) return;
+
+    int vertexCount = static_cast<int>(quads * 6);
+    UpdateMeshBuffer(mesh, 0, mesh.vertices, vertexCount * 3 * sizeof(float), 0);
+    UpdateMeshBuffer(mesh, 3, mesh.colors, vertexCount * 4, 0);
+
+    // Anything still queued in raylib's immediate batch was drawn before us.
+    rlDrawRenderBatchActive();
+
+    Mesh visible = mesh;
+    visible.vertexCount = vertexCount;
+    visible.triangleCount = static_cast<int>(quads * 2);
+    DrawMesh(visible, material, MatrixIdentity());
+}
+
+void ParticleRenderer::unload() {
+    if (!loaded) return;
+    UnloadMesh(mesh);
+    UnloadMaterial(material);  // also releases the sprite texture
+    mesh = {};
+    material = {};
+    capacityQuads = 0;
+    loaded = false;
+}
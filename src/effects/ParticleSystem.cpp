@@ -1,12 +1,77 @@
 #include "effects/ParticleSystem.hpp"
-#include "effects/ParticleThreadPool.hpp"
+#include "core/Parallel.hpp"
+#include "core/RngService.hpp"
 #include <cmath>
-#include <cstdlib>
-#include <thread>
 #include <algorithm>
-#include <future>
 
-ParticleSystem::ParticleSystem() {
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PARTICLES_USE_SSE 1
+#endif
+
+namespace {
+    constexpr float PARTICLE_GRAVITY = 200.0f;
+    constexpr float PARTICLE_DAMPING = 0.98f;
+
+    // Random draws per emitted particle, fetched in one batched fill.
+    constexpr int EXPLOSION_DRAWS = 3;
+    constexpr int SPARK_DRAWS = 7;
+}
+
+void ParticleStreams::allocate(size_t capacity) {
+    px.resize(capacity);
+    py.resize(capacity);
+    vx.resize(capacity);
+    vy.resize(capacity);
+    life.resize(capacity);
+    invMaxLife.resize(capacity);
+    alpha.resize(capacity);
+    radius.resize(capacity);
+    color.resize(capacity);
+    priority.resize(capacity);
+    count = 0;
+}
+
+bool ParticleStreams::push(const Particle& particle) {
+    if (count == capacity()) return false;
+
+    size_t i = count++;
+    px[i] = particle.position.x;
+    py[i] = particle.position.y;
+    vx[i] = particle.velocity.x;
+    vy[i] = particle.velocity.y;
+    life[i] = particle.life;
+    invMaxLife[i] = particle.maxLife > 0.0f ? 1.0f / particle.maxLife : 0.0f;
+    alpha[i] = particle.color.a / 255.0f;
+    radius[i] = particle.size;
+    color[i] = particle.color;
+    priority[i] = particle.priority;
+    return true;
+}
+
+void ParticleStreams::swapRemove(size_t index) {
+    size_t last = --count;
+    if (index != last) {
+        px[index] = px[last];
+        py[index] = py[last];
+        vx[index] = vx[last];
+        vy[index] = vy[last];
+        life[index] = life[last];
+        invMaxLife[index] = invMaxLife[last];
+        alpha[index] = alpha[last];
+        radius[index] = radius[last];
+        color[index] = color[last];
+        priority[index] = priority[last];
+    }
+}
+
+ParticleSystem::ParticleSystem() : emissionRing(new EmissionSlot[EMISSION_CAPACITY]) {
+    static_assert((EMISSION_CAPACITY & (EMISSION_CAPACITY - 1)) == 0, "emission ring size must be a power of two");
+    particles.allocate(MAX_PARTICLES);
+    importance.resize(MAX_PARTICLES);
+    for (size_t i = 0; i < EMISSION_CAPACITY; ++i) {
+        emissionRing[i].sequence.store(0, std::memory_order_relaxed);
+    }
 }
 
 ParticleSystem& ParticleSystem::getInstance() {
@@ -14,121 +79,229 @@ ParticleSystem& ParticleSystem::getInstance() {
     return instance;
 }
 
-void ParticleSystem::createExplosion(Vector2 position, int count, Color color, float duration, float speed) {
-    auto future = ParticleThreadPool::getInstance().getPool().enqueue([=]() {
-        std::vector<Particle> newParticles;
-        newParticles.reserve(count);
-        
-        for (int i = 0; i < count; ++i) {
-            Particle particle;
-            particle.position = position;
-            
-            float angle = ((float)rand() / RAND_MAX) * 2.0f * M_PI;
-            float velocityMagnitude = speed * (0.5f + ((float)rand() / RAND_MAX) * 0.5f);
-            
-            particle.velocity.x = cos(angle) * velocityMagnitude;
-            particle.velocity.y = sin(angle) * velocityMagnitude;
-            
-            particle.color = color;
-            particle.life = duration;
-            particle.maxLife = duration;
-            particle.size = 2.0f + ((float)rand() / RAND_MAX) * 3.0f;
-            
-            newParticles.push_back(particle);
+bool ParticleSystem::reserveEmission(size_t count, size_t& first) {
+    size_t head = emissionHead.load(std::memory_order_relaxed);
+    do {
+        size_t tail = emissionTail.load(std::memory_order_acquire);
+        if (head + count - tail > EMISSION_CAPACITY) {
+            return false;
         }
-        
-        {
-            std::lock_guard<std::mutex> lock(pendingMutex);
-            pendingParticles.push(std::move(newParticles));
-        }
-    });
+    } while (!emissionHead.compare_exchange_weak(head, head + count, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    first = head;
+    return true;
 }
 
-void ParticleSystem::createDustParticle(Vector2 position, Vector2 velocity, float lifetime) {
-    auto future = ParticleThreadPool::getInstance().getPool().enqueue([=]() {
-        std::vector<Particle> newParticles;
-        newParticles.reserve(1);
-        
-        Particle particle;
+void ParticleSystem::publishEmission(size_t position) {
+    emissionRing[position & (EMISSION_CAPACITY - 1)].sequence.store(position + 1, std::memory_order_release);
+}
+
+void ParticleSystem::emit(const Particle* source, int count) {
+    size_t first;
+    if (count <= 0 || !reserveEmission(count, first)) return;
+
+    for (int i = 0; i < count; ++i) {
+        emissionSlot(first + i) = source[i];
+        publishEmission(first + i);
+    }
+}
+
+void ParticleSystem::createExplosion(Vector2 position, int count, Color color, float duration, float speed) {
+    size_t first;
+    if (count <= 0 || !reserveEmission(count, first)) return;
+
+    FastRNG& rng = RngService::getInstance().local(RngStream::PARTICLES);
+    for (int i = 0; i < count; ++i) {
+        float draws[EXPLOSION_DRAWS];
+        rng.fillFloats(draws, EXPLOSION_DRAWS);
+
+        Particle& particle = emissionSlot(first + i);
         particle.position = position;
-        particle.velocity = velocity;
-        particle.color = { 200, 200, 180, 180 };
-        particle.life = lifetime;
-        particle.maxLife = lifetime;
-        particle.size = 4.0f;
-        
-        newParticles.push_back(particle);
-        
-        {
-            std::lock_guard<std::mutex> lock(pendingMutex);
-            pendingParticles.push(std::move(newParticles));
-        }
-    });
+
+        float angle = draws[0] * 2.0f * M_PI;
+        float velocityMagnitude = speed * (0.5f + draws[1] * 0.5f);
+
+        particle.velocity.x = cos(angle) * velocityMagnitude;
+        particle.velocity.y = sin(angle) * velocityMagnitude;
+
+        particle.color = color;
+        particle.life = duration;
+        particle.maxLife = duration;
+        particle.size = 2.0f + draws[2] * 3.0f;
+        particle.priority = ParticlePriority::EFFECT;
+
+        publishEmission(first + i);
+    }
+}
+
+void ParticleSystem::createDustParticle(Vector2 position, Vector2 velocity, float lifetime) {
+    size_t first;
+    if (!reserveEmission(1, first)) return;
+
+    Particle& particle = emissionSlot(first);
+    particle.position = position;
+    particle.velocity = velocity;
+    particle.color = { 200, 200, 180, 180 };
+    particle.life = lifetime;
+    particle.maxLife = lifetime;
+    particle.size = 4.0f;
+    particle.priority = ParticlePriority::AMBIENT;
+
+    publishEmission(first);
 }
 
 void ParticleSystem::createExplosionParticles(Vector2 position, int count, Color baseColor) {
-    auto future = ParticleThreadPool::getInstance().getPool().enqueue([=]() {
-        std::vector<Particle> newParticles;
-        newParticles.reserve(count);
-        
-        for (int i = 0; i < count; ++i) {
-            float angle = ((float)rand() / RAND_MAX) * 2.0f * M_PI;
-            float speed = 50.0f + ((float)rand() / RAND_MAX) * 100.0f;
-            
-            Vector2 velocity = {
-                (float)(cos(angle) * speed),
-                (float)(sin(angle) * speed)
-            };
-            
-            float lifetime = 0.3f + ((float)rand() / RAND_MAX) * 0.4f;
-            float size = 1.0f + ((float)rand() / RAND_MAX) * 3.0f;
-            
-            Color particleColor = baseColor;
-            particleColor.r = (unsigned char)std::max(0, std::min(255, (int)particleColor.r + (rand() % 40) - 20));
-            particleColor.g = (unsigned char)std::max(0, std::min(255, (int)particleColor.g + (rand() % 40) - 20));
-            particleColor.b = (unsigned char)std::max(0, std::min(255, (int)particleColor.b + (rand() % 40) - 20));
-            
-            Particle particle;
-            particle.position = position;
-            particle.velocity = velocity;
-            particle.color = particleColor;
-            particle.life = lifetime;
-            particle.maxLife = lifetime;
-            particle.size = size;
-            
-            newParticles.push_back(particle);
-        }
-        
-        {
-            std::lock_guard<std::mutex> lock(pendingMutex);
-            pendingParticles.push(std::move(newParticles));
-        }
-    });
+    size_t first;
+    if (count <= 0 || !reserveEmission(count, first)) return;
+
+    FastRNG& rng = RngService::getInstance().local(RngStream::PARTICLES);
+    for (int i = 0; i < count; ++i) {
+        float draws[SPARK_DRAWS];
+        rng.fillFloats(draws, SPARK_DRAWS);
+
+        float angle = draws[0] * 2.0f * M_PI;
+        float speed = 50.0f + draws[1] * 100.0f;
+
+        Color particleColor = baseColor;
+        particleColor.r = (unsigned char)std::max(0, std::min(255, (int)particleColor.r + (int)(draws[2] * 40.0f) - 20));
+        particleColor.g = (unsigned char)std::max(0, std::min(255, (int)particleColor.g + (int)(draws[3] * 40.0f) - 20));
+        particleColor.b = (unsigned char)std::max(0, std::min(255, (int)particleColor.b + (int)(draws[4] * 40.0f) - 20));
+
+        Particle& particle = emissionSlot(first + i);
+        particle.position = position;
+        particle.velocity = { (float)(cos(angle) * speed), (float)(sin(angle) * speed) };
+        particle.color = particleColor;
+        particle.life = 0.3f + draws[5] * 0.4f;
+        particle.maxLife = particle.life;
+        particle.size = 1.0f + draws[6] * 3.0f;
+        particle.priority = ParticlePriority::EFFECT;
+
+        publishEmission(first + i);
+    }
 }
 
 void ParticleSystem::processPendingParticles() {
-    std::lock_guard<std::mutex> pendingLock(pendingMutex);
-    while (!pendingParticles.empty()) {
-        auto& newParticles = pendingParticles.front();
-        particles.insert(particles.end(), newParticles.begin(), newParticles.end());
-        pendingParticles.pop();
+    // Stops at the first slot a producer has reserved but not yet published;
+    // the rest is picked up next frame.
+    size_t tail = emissionTail.load(std::memory_order_relaxed);
+    for (;;) {
+        EmissionSlot& slot = emissionRing[tail & (EMISSION_CAPACITY - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != tail + 1) break;
+        particles.push(slot.particle);
+        ++tail;
     }
+    emissionTail.store(tail, std::memory_order_release);
 }
 
 void ParticleSystem::updateParticleRange(size_t start, size_t end, float deltaTime) {
-    for (size_t i = start; i < end; ++i) {
-        auto& particle = particles[i];
-        particle.life -= deltaTime;
-        
-        particle.position.x += particle.velocity.x * deltaTime;
-        particle.position.y += particle.velocity.y * deltaTime;
-        
-        particle.velocity.y += 200.0f * deltaTime;
-        particle.velocity.x *= 0.98f;
-        particle.velocity.y *= 0.98f;
-        
-        float alpha = particle.life / particle.maxLife;
-        particle.color.a = (unsigned char)(255 * alpha);
+    float* px = particles.px.data();
+    float* py = particles.py.data();
+    float* vx = particles.vx.data();
+    float* vy = particles.vy.data();
+    float* life = particles.life.data();
+    float* alpha = particles.alpha.data();
+    const float* invMaxLife = particles.invMaxLife.data();
+
+    size_t i = start;
+#ifdef PARTICLES_USE_SSE
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 gravity = _mm_set1_ps(PARTICLE_GRAVITY * deltaTime);
+    const __m128 damping = _mm_set1_ps(PARTICLE_DAMPING);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= end; i += 4) {
+        __m128 l = _mm_sub_ps(_mm_loadu_ps(life + i), dt);
+        __m128 velX = _mm_loadu_ps(vx + i);
+        __m128 velY = _mm_loadu_ps(vy + i);
+
+        _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(velX, dt)));
+        _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(velY, dt)));
+        _mm_storeu_ps(vx + i, _mm_mul_ps(velX, damping));
+        _mm_storeu_ps(vy + i, _mm_mul_ps(_mm_add_ps(velY, gravity), damping));
+        _mm_storeu_ps(life + i, l);
+        _mm_storeu_ps(alpha + i, _mm_max_ps(_mm_mul_ps(l, _mm_loadu_ps(invMaxLife + i)), zero));
+    }
+#endif
+    for (; i < end; ++i) {
+        life[i] -= deltaTime;
+
+        px[i] += vx[i] * deltaTime;
+        py[i] += vy[i] * deltaTime;
+
+        vy[i] += PARTICLE_GRAVITY * deltaTime;
+        vx[i] *= PARTICLE_DAMPING;
+        vy[i] *= PARTICLE_DAMPING;
+
+        alpha[i] = std::max(0.0f, life[i] * invMaxLife[i]);
+    }
+}
+
+void ParticleSystem::removeDeadParticles() {
+    size_t i = 0;
+    while (i < particles.size()) {
+        if (particles.life[i] <= 0.0f) {
+            particles.swapRemove(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+// Ranks every particle into one of 256 importance buckets (priority, then
+// on-screen, then distance to the view centre, then remaining life), finds
+// the bucket where the excess runs out from a histogram and removes
+// everything below it. Two linear passes, no sort.
+void ParticleSystem::cullToBudget() {
+    size_t count = particles.size();
+    if (count <= particleBudget) return;
+    size_t excess = count - particleBudget;
+
+    float margin = 64.0f;
+    float left = lastView.x - margin;
+    float top = lastView.y - margin;
+    float right = lastView.x + lastView.width + margin;
+    float bottom = lastView.y + lastView.height + margin;
+    float centerX = lastView.x + lastView.width * 0.5f;
+    float centerY = lastView.y + lastView.height * 0.5f;
+    float invRadius = 1.0f / std::max(1.0f, std::max(lastView.width, lastView.height));
+
+    size_t histogram[256] = {};
+    for (size_t i = 0; i < count; ++i) {
+        float x = particles.px[i];
+        float y = particles.py[i];
+        int visible = (x >= left && x <= right && y >= top && y <= bottom) ? 1 : 0;
+
+        float dx = x - centerX;
+        float dy = y - centerY;
+        float distance = std::sqrt(dx * dx + dy * dy) * invRadius;
+        int closeness = 7 - std::min(7, static_cast<int>(distance * 4.0f));
+
+        float remaining = particles.life[i] * particles.invMaxLife[i];
+        int youth = std::min(3, std::max(0, static_cast<int>(remaining * 4.0f)));
+
+        uint8_t rank = static_cast<uint8_t>((static_cast<int>(particles.priority[i]) << 6) | (visible << 5) | (closeness << 2) | youth);
+        importance[i] = rank;
+        ++histogram[rank];
+    }
+
+    int threshold = 0;
+    size_t below = 0;
+    while (below + histogram[threshold] < excess) {
+        below += histogram[threshold];
+        ++threshold;
+    }
+    size_t takeFromThreshold = excess - below;
+
+    size_t i = 0;
+    while (i < particles.size()) {
+        int rank = importance[i];
+        bool cull = rank < threshold || (rank == threshold && takeFromThreshold > 0);
+        if (cull) {
+            if (rank == threshold) --takeFromThreshold;
+            importance[i] = importance[particles.size() - 1];
+            particles.swapRemove(i);
+        } else {
+            ++i;
+        }
     }
 }
 
@@ -136,49 +309,36 @@ void ParticleSystem::update(float deltaTime) {
     processPendingParticles();
     
     if (particles.empty()) return;
+    cullToBudget();
     
-    size_t numThreads = std::min(static_cast<size_t>(std::thread::hardware_concurrency()), particles.size() / 100 + 1);
-    
-    if (particles.size() < 500 || numThreads <= 1) {
-        updateParticleRange(0, particles.size(), deltaTime);
-    } else {
-        size_t particlesPerThread = particles.size() / numThreads;
-        std::vector<std::future<void>> futures;
-        
-        for (size_t t = 0; t < numThreads; ++t) {
-            size_t start = t * particlesPerThread;
-            size_t end = (t == numThreads - 1) ? particles.size() : start + particlesPerThread;
-            
-            futures.push_back(ParticleThreadPool::getInstance().getPool().enqueue([this, start, end, deltaTime]() {
-                updateParticleRange(start, end, deltaTime);
-            }));
-        }
-        
-        for (auto& future : futures) {
-            future.wait();
-        }
-    }
+    // Below one grain parallel_for runs inline, which covers the common case.
+    constexpr size_t PARTICLE_GRAIN = 4096;
+    parallel_for(0, particles.size(), PARTICLE_GRAIN, [this, deltaTime](size_t start, size_t end) {
+        updateParticleRange(start, end, deltaTime);
+    });
     
-    particles.erase(
-        std::remove_if(particles.begin(), particles.end(),
-            [](const Particle& p) { return p.life <= 0.0f; }),
-        particles.end()
-    );
+    removeDeadParticles();
 }
 
-void ParticleSystem::draw() {
+void ParticleSystem::draw(const Camera2D& camera, ParticleLayer layer) {
     std::lock_guard<std::mutex> lock(particleMutex);
-    for (const auto& particle : particles) {
-        DrawCircleV(particle.position, particle.size, particle.color);
-    }
+
+    float zoom = camera.zoom > 0.0f ? camera.zoom : 1.0f;
+    lastView.x = camera.target.x - camera.offset.x / zoom;
+    lastView.y = camera.target.y - camera.offset.y / zoom;
+    lastView.width = GetScreenWidth() / zoom;
+    lastView.height = GetScreenHeight() / zoom;
+
+    renderer.draw(particles, lastView, layer);
+}
+
+void ParticleSystem::unloadRenderResources() {
+    std::lock_guard<std::mutex> lock(particleMutex);
+    renderer.unload();
 }
 
 void ParticleSystem::clear() {
     std::lock_guard<std::mutex> lock(particleMutex);
+    processPendingParticles();
     particles.clear();
-    
-    std::lock_guard<std::mutex> pendingLock(pendingMutex);
-    while (!pendingParticles.empty()) {
-        pendingParticles.pop();
-    }
 }
@@ -0,0 +1,108 @@
+#include "enemies/AiLodScheduler.hpp"
+#include "map/Map.hpp"
+#include "PlayerVisibility.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+AiLodScheduler::AiLodScheduler()
+    : tierCounts(std::make_unique<std::atomic<uint32_t>[]>(TIER_COUNT)) {}
+
+void AiLodScheduler::track(EnemyHandle handle) {
+    auto& typeStates = states[static_cast<int>(handle.type)];
+    if (handle.index >= typeStates.size()) {
+        typeStates.resize(handle.index + 1);
+    }
+    typeStates[handle.index] = State{};
+}
+
+void AiLodScheduler::beginTick(const Map& map, Vector2 newPlayerPos) {
+    if (&map != indexedMap || map.getGeneratedRooms().size() != indexedRoomCount) {
+        buildRoomIndex(map);
+    }
+    ++tick;
+    playerPos = newPlayerPos;
+    playerRoom = roomAt(playerPos);
+    for (int i = 0; i < TIER_COUNT; ++i) {
+        tierCounts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void AiLodScheduler::buildRoomIndex(const Map& map) {
+    indexedMap = &map;
+    width = map.getWidth();
+    height = map.getHeight();
+    roomIndex.assign(static_cast<size_t>(width) * height, -1);
+
+    const auto& rooms = map.getGeneratedRooms();
+    indexedRoomCount = rooms.size();
+    for (size_t i = 0; i < rooms.size(); ++i) {
+        const Room& room = rooms[i];
+        for (int x = std::max(room.startX, 0); x < std::min(room.endX, width); ++x) {
+            for (int y = std::max(room.startY, 0); y < std::min(room.endY, height); ++y) {
+                int16_t& cell = roomIndex[static_cast<size_t>(x) * height + y];
+                if (cell < 0) cell = static_cast<int16_t>(i);
+            }
+        }
+    }
+}
+
+int AiLodScheduler::roomAt(Vector2 position) const {
+    int x = static_cast<int>(std::floor(position.x / 32.0f));
+    int y = static_cast<int>(std::floor(position.y / 32.0f));
+    if (x < 0 || y < 0 || x >= width || y >= height) return -1;
+    return roomIndex[static_cast<size_t>(x) * height + y];
+}
+
+AiTier AiLodScheduler::classify(const State& state, Vector2 position) const {
+    float dx = position.x - playerPos.x;
+    float dy = position.y - playerPos.y;
+    float distanceSq = dx * dx + dy * dy;
+    int room = roomAt(position);
+
+    // OPAQUE lets sight through platforms, so it covers both blockers.
+    if (distanceSq <= ACTIVE_RANGE * ACTIVE_RANGE ||
+        (room >= 0 && room == playerRoom) ||
+        PlayerVisibility::getInstance().canSeePlayer(position, RayBlocker::OPAQUE)) {
+        return AiTier::ACTIVE;
+    }
+    if (room >= 0 && (state.tier == AiTier::DORMANT || distanceSq > WAKE_RANGE * WAKE_RANGE)) {
+        return AiTier::DORMANT;
+    }
+    return AiTier::REDUCED;
+}
+
+int AiLodScheduler::schedule(EnemyHandle handle, Vector2 position, float dt, float& stepDt) {
+    auto& typeStates = states[static_cast<int>(handle.type)];
+    if (handle.index >= typeStates.size()) {
+        stepDt = dt;
+        return 1;
+    }
+
+    State& state = typeStates[handle.index];
+    state.tier = classify(state, position);
+    tierCounts[static_cast<int>(state.tier)].fetch_add(1, std::memory_order_relaxed);
+
+    if (state.tier == AiTier::DORMANT) {
+        state.pendingDt = 0.0f;
+        return 0;
+    }
+    state.pendingDt += dt;
+    if (state.tier == AiTier::REDUCED && (tick + handle.index) % REDUCED_INTERVAL != 0) {
+        return 0;
+    }
+
+    // The epsilon keeps float noise in the sum from adding a step.
+    float maxStep = std::max(dt, MAX_CATCH_UP_STEP);
+    int steps = std::max(1, static_cast<int>(std::ceil(state.pendingDt / maxStep - 1e-3f)));
+    stepDt = state.pendingDt / steps;
+    state.pendingDt = 0.0f;
+    return steps;
+}
+
+void AiLodScheduler::dumpStats() const {
+    printf("[AiLodScheduler] %zu active, %zu reduced, %zu dormant\n",
+           getTierCount(AiTier::ACTIVE),
+           getTierCount(AiTier::REDUCED),
+           getTierCount(AiTier::DORMANT));
+}
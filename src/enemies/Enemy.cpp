@@ -2,7 +2,12 @@
 
 Enemy::Enemy(Vector2 pos, int hp, int maxHp, float spd)
     : position(pos), velocity{0, 0}, health(static_cast<float>(hp)), 
-      maxHealth(static_cast<float>(maxHp)), speed(spd) {}
+      maxHealth(static_cast<float>(maxHp)), speed(spd),
+      pathHandle(PathfindingService::getInstance().acquire()) {}
+
+Enemy::~Enemy() {
+    PathfindingService::getInstance().release(pathHandle);
+}
 
 Enemy::Enemy(Enemy&& other) noexcept
     : position(other.position),
@@ -15,8 +20,11 @@ Enemy::Enemy(Enemy&& other) noexcept
       currentColor(other.currentColor),
       speed(other.speed),
       path(std::move(other.path)),
-      pathfindingInProgress(other.pathfindingInProgress.load()),
-      pathReady(other.pathReady.load()) {}
+      pathHandle(other.pathHandle),
+      repathTimer(other.repathTimer),
+      lastRepathTarget(other.lastRepathTarget) {
+    other.pathHandle = PathHandle{};
+}
 
 Enemy& Enemy::operator=(Enemy&& other) noexcept {
     if (this != &other) {
@@ -30,8 +38,11 @@ Enemy& Enemy::operator=(Enemy&& other) noexcept {
         currentColor = other.currentColor;
         speed = other.speed;
         path = std::move(other.path);
-        pathfindingInProgress.store(other.pathfindingInProgress.load());
-        pathReady.store(other.pathReady.load());
+        PathfindingService::getInstance().release(pathHandle);
+        pathHandle = other.pathHandle;
+        other.pathHandle = PathHandle{};
+        repathTimer = other.repathTimer;
+        lastRepathTarget = other.lastRepathTarget;
     }
     return *this;
 }
@@ -50,3 +61,15 @@ void Enemy::takeDamage(int amount) {
 void Enemy::applyKnockback(Vector2 force) {
     velocity = force;
 }
+
+void Enemy::requestPath(Vector2 start, Vector2 goal) {
+    PathfindingService::getInstance().request(pathHandle, start, goal);
+}
+
+bool Enemy::isPathPending() const {
+    return PathfindingService::getInstance().isPending(pathHandle);
+}
+
+bool Enemy::pollPath() {
+    return PathfindingService::getInstance().poll(pathHandle, path);
+}
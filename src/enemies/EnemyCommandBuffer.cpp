@@ -0,0 +1,86 @@
+#include "enemies/EnemyCommandBuffer.hpp"
+#include "map/Map.hpp"
+#include "Camera.hpp"
+#include "CombatResolver.hpp"
+#include "effects/ParticleSystem.hpp"
+
+EnemyCommand& EnemyCommandBuffer::push(EnemyCommandType type) {
+    commands.emplace_back();
+    commands.back().type = type;
+    return commands.back();
+}
+
+void EnemyCommandBuffer::removePlatform(int tileX, int tileY) {
+    EnemyCommand& command = push(EnemyCommandType::REMOVE_PLATFORM);
+    command.tileX = tileX;
+    command.tileY = tileY;
+}
+
+void EnemyCommandBuffer::hitPlayer(int damage, Vector2 knockback) {
+    EnemyCommand& command = push(EnemyCommandType::HIT_PLAYER);
+    command.amount = damage;
+    command.vector = knockback;
+}
+
+void EnemyCommandBuffer::shakeCamera(float intensity, float duration) {
+    EnemyCommand& command = push(EnemyCommandType::SHAKE_CAMERA);
+    command.intensity = intensity;
+    command.duration = duration;
+}
+
+void EnemyCommandBuffer::particles(Vector2 position, int count, Color color) {
+    EnemyCommand& command = push(EnemyCommandType::PARTICLES);
+    command.position = position;
+    command.amount = count;
+    command.color = color;
+}
+
+void EnemyCommandBuffer::explosion(Vector2 position, int count, Color color, float duration, float speed) {
+    EnemyCommand& command = push(EnemyCommandType::EXPLOSION);
+    command.position = position;
+    command.amount = count;
+    command.color = color;
+    command.duration = duration;
+    command.speed = speed;
+}
+
+void EnemyCommandBuffer::fireProjectile(const ProjectileSpawn& projectile) {
+    push(EnemyCommandType::FIRE_PROJECTILE).amount = static_cast<int>(projectiles.size());
+    projectiles.push_back(projectile);
+    projectiles.back().owner = source;
+}
+
+void EnemyCommandBuffer::apply(Map& map, GameCamera& camera) {
+    ParticleSystem& particleSystem = ParticleSystem::getInstance();
+    for (const EnemyCommand& command : commands) {
+        switch (command.type) {
+            case EnemyCommandType::REMOVE_PLATFORM:
+                // Re-checked: an earlier command may already have cleared it.
+                if (map.getTileValue(command.tileX, command.tileY) == MapConstants::PLATFORM_TILE_VALUE) {
+                    map.setTileValue(command.tileX, command.tileY, MapConstants::EMPTY_TILE_VALUE);
+                }
+                break;
+            case EnemyCommandType::HIT_PLAYER: {
+                HitCandidate hit;
+                hit.source = HitSource::EXPLOSION;
+                hit.damage = command.amount;
+                hit.knockback = command.vector;
+                CombatResolver::getInstance().submit(hit);
+                break;
+            }
+            case EnemyCommandType::SHAKE_CAMERA:
+                camera.addScreenshake(command.intensity, command.duration);
+                break;
+            case EnemyCommandType::PARTICLES:
+                particleSystem.createExplosionParticles(command.position, command.amount, command.color);
+                break;
+            case EnemyCommandType::EXPLOSION:
+                particleSystem.createExplosion(command.position, command.amount, command.color, command.duration, command.speed);
+                break;
+            case EnemyCommandType::FIRE_PROJECTILE:
+                ProjectileSystem::getInstance().spawn(projectiles[command.amount]);
+                break;
+        }
+    }
+    clear();
+}
@@ -1,79 +1,141 @@
 #include "enemies/EnemyManager.hpp"
 #include "map/Map.hpp"
 #include "Camera.hpp"
+#include "Player.hpp"
+#include "core/Parallel.hpp"
 
-void EnemyManager::addEnemy(std::unique_ptr<Enemy> enemy) {
-    enemies.push_back(std::move(enemy));
+size_t EnemyView::size() const {
+    return manager.getEnemyCount();
+}
+
+Enemy& EnemyView::operator[](size_t i) const {
+    if (i < manager.scrapHounds.size()) return manager.scrapHounds[i];
+    i -= manager.scrapHounds.size();
+    if (i < manager.automatons.size()) return manager.automatons[i];
+    return manager.detonodes[i - manager.automatons.size()];
+}
+
+EnemyHandle EnemyManager::spawnEnemy(EnemyType type, Vector2 position) {
+    EnemyHandle handle;
+    switch (type) {
+        case EnemyType::SCRAP_HOUND: handle = scrapHounds.create(position); break;
+        case EnemyType::AUTOMATON: handle = automatons.create(position); break;
+        case EnemyType::DETONODE: handle = detonodes.create(position); break;
+    }
+    if (handle.isValid()) {
+        lodScheduler.track(handle);
+    }
+    return handle;
+}
+
+Enemy* EnemyManager::getEnemy(EnemyHandle handle) {
+    switch (handle.type) {
+        case EnemyType::SCRAP_HOUND: return scrapHounds.get(handle);
+        case EnemyType::AUTOMATON: return automatons.get(handle);
+        case EnemyType::DETONODE: return detonodes.get(handle);
+    }
+    return nullptr;
 }
 
 void EnemyManager::removeDeadEnemies() {
-    enemies.erase(
-        std::remove_if(enemies.begin(), enemies.end(),
-                       [](const std::unique_ptr<Enemy>& enemy) {
-                           return !enemy->isAlive();
-                       }),
-        enemies.end());
+    auto dead = [](const Enemy& enemy) { return !enemy.isAlive(); };
+    scrapHounds.removeIf(dead);
+    automatons.removeIf(dead);
+    detonodes.removeIf(dead);
 }
 
-void EnemyManager::updateEnemies(const Map& map, Vector2 playerPos, float dt) {
-    for (auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            enemy->update(map, playerPos, dt);
+namespace {
+    // Runs the updates the LOD scheduler grants this tick; step(stepDt) is one update.
+    template <typename T, typename Step>
+    void RunScheduled(AiLodScheduler& scheduler, T& enemy, EnemyHandle handle, float dt, EnemyCommandBuffer& commands, Step&& step) {
+        if (!enemy.isAlive()) return;
+        commands.setSource(handle);
+        float stepDt = dt;
+        int steps = scheduler.schedule(handle, enemy.getPosition(), dt, stepDt);
+        for (int i = 0; i < steps && enemy.isAlive(); ++i) {
+            step(stepDt);
         }
     }
 }
 
-void EnemyManager::updateEnemies(Map& map, Vector2 playerPos, float dt, GameCamera& camera) {
-    for (auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            if (enemy->getType() == EnemyType::DETONODE) {
-                Detonode* detonode = static_cast<Detonode*>(enemy.get());
-                detonode->update(map, playerPos, dt, camera);
+// Enemies are cut into fixed AI_GRAIN slices, each with its own command
+// buffer; replaying the buffers in slice order applies the commands in
+// enemy order, whichever worker ran each slice.
+void EnemyManager::updateEnemies(Map& map, const Player& player, float dt, GameCamera& camera) {
+    const Map& world = map;
+    Vector2 playerPos = player.getPosition();
+    size_t houndCount = scrapHounds.size();
+    size_t automatonEnd = houndCount + automatons.size();
+    size_t total = getEnemyCount();
+    size_t slices = (total + AI_GRAIN - 1) / AI_GRAIN;
+    if (commandBuffers.size() < slices) {
+        commandBuffers.resize(slices);
+    }
+    lodScheduler.beginTick(map, playerPos);
+
+    parallel_for(0, total, AI_GRAIN, [&](size_t begin, size_t end) {
+        EnemyCommandBuffer& commands = commandBuffers[begin / AI_GRAIN];
+        for (size_t i = begin; i < end; ++i) {
+            if (i < houndCount) {
+                ScrapHound& hound = scrapHounds[i];
+                RunScheduled(lodScheduler, hound, scrapHounds.handleAt(i), dt, commands, [&](float stepDt) {
+                    hound.update(world, playerPos, stepDt);
+                });
+            } else if (i < automatonEnd) {
+                size_t index = i - houndCount;
+                Automaton& automaton = automatons[index];
+                RunScheduled(lodScheduler, automaton, automatons.handleAt(index), dt, commands, [&](float stepDt) {
+                    automaton.update(world, playerPos, stepDt, commands);
+                });
             } else {
-                enemy->update(map, playerPos, dt);
+                size_t index = i - automatonEnd;
+                Detonode& detonode = detonodes[index];
+                RunScheduled(lodScheduler, detonode, detonodes.handleAt(index), dt, commands, [&](float stepDt) {
+                    detonode.update(world, playerPos, stepDt, commands);
+                });
             }
         }
+    });
+
+    for (size_t i = 0; i < slices; ++i) {
+        commandBuffers[i].apply(map, camera);
     }
 }
 
 void EnemyManager::drawEnemies() const {
-    for (const auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            enemy->draw();
-        }
+    for (const auto& hound : scrapHounds) {
+        if (hound.isAlive()) hound.draw();
+    }
+    for (const auto& automaton : automatons) {
+        if (automaton.isAlive()) automaton.draw();
+    }
+    for (const auto& detonode : detonodes) {
+        if (detonode.isAlive()) detonode.draw();
     }
 }
 
 void EnemyManager::clearEnemies() {
-    enemies.clear();
+    scrapHounds.clear();
+    automatons.clear();
+    detonodes.clear();
 }
 
-std::vector<Enemy*> EnemyManager::getEnemiesOfType(EnemyType type) const {
-    std::vector<Enemy*> result;
-    for (const auto& enemy : enemies) {
-        if (enemy->getType() == type && enemy->isAlive()) {
-            result.push_back(enemy.get());
+namespace {
+    template <typename T>
+    size_t CountAlive(const EnemyPool<T>& pool) {
+        size_t count = 0;
+        for (const auto& enemy : pool) {
+            if (enemy.isAlive()) count++;
         }
+        return count;
     }
-    return result;
-}
-
-std::vector<Enemy*> EnemyManager::getAllEnemies() const {
-    std::vector<Enemy*> result;
-    for (const auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            result.push_back(enemy.get());
-        }
-    }
-    return result;
 }
 
 size_t EnemyManager::getEnemyCountOfType(EnemyType type) const {
-    size_t count = 0;
-    for (const auto& enemy : enemies) {
-        if (enemy->getType() == type && enemy->isAlive()) {
-            count++;
-        }
+    switch (type) {
+        case EnemyType::SCRAP_HOUND: return CountAlive(scrapHounds);
+        case EnemyType::AUTOMATON: return CountAlive(automatons);
+        case EnemyType::DETONODE: return CountAlive(detonodes);
     }
-    return count;
+    return 0;
 }
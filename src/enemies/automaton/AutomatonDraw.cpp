@@ -11,17 +11,4 @@ void Automaton::draw() const {
     DrawRectangle(barX, barY, (int)barWidth, (int)barHeight, DARKGRAY);
     DrawRectangle(barX, barY, (int)(barWidth * healthRatio), (int)barHeight, LIME);
     DrawRectangle((int)position.x, (int)position.y, 32, 32, currentColor);
-    for (const auto& proj : projectiles) {
-        if (proj.active) proj.draw();
-    }
-}
-
-void AutomatonProjectile::draw() const {
-    if (!active) return;
-    DrawCircle((int)position.x + 8, (int)position.y + 8, 8, RED);
-}
-
-Rectangle AutomatonProjectile::getHitbox() const {
-    if (!active) return Rectangle{0, 0, 0, 0};
-    return Rectangle{position.x, position.y, 16, 16};
 }
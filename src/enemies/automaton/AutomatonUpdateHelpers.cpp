@@ -1,12 +1,17 @@
 #include "enemies/Automaton.hpp"
+#include "enemies/EnemyCommandBuffer.hpp"
+#include "FlowField.hpp"
+#include "PlayerVisibility.hpp"
 #include <raymath.h>
 #include <cmath>
-#include <mutex>
 
 using namespace MapConstants;
 
 namespace AutomatonConstants {
     constexpr float ProjectileSpeed = 250.0f;
+    constexpr float ProjectileSize = 16.0f;
+    constexpr float ProjectileLifetime = 2.0f;
+    constexpr int ProjectileDamage = 15;
     constexpr int PathTimerThreshold = 30;
     constexpr float PlayerMovedThreshold = 64.0f;
     constexpr float PathTargetRadius = 16.0f;
@@ -16,7 +21,7 @@ namespace AutomatonConstants {
     constexpr float TileSize = 32.0f;
 }
 
-void Automaton::update(const Map& map, Vector2 playerPos, float dt) {
+void Automaton::update(const Map& map, Vector2 playerPos, float dt, EnemyCommandBuffer& commands) {
 
     if (!alive) return;
     if (invincibilityTimer > 0.0f) invincibilityTimer -= dt;
@@ -29,30 +34,38 @@ void Automaton::update(const Map& map, Vector2 playerPos, float dt) {
     shootCooldown -= dt;
     if (shootCooldown <= 0.0f) {
 
-        if (hasLineOfSight(map, position, playerPos)) {
+        // Platforms don't block the automaton's aim.
+        if (PlayerVisibility::getInstance().canSeePlayer(position, RayBlocker::OPAQUE)) {
             Vector2 dir = Vector2Subtract(playerPos, position);
             dir = Vector2Normalize(dir);
-            projectiles.emplace_back(position, Vector2Scale(dir, AutomatonConstants::ProjectileSpeed));
+            ProjectileSpawn shot;
+            shot.kind = ProjectileKind::AUTOMATON_SHOT;
+            shot.faction = Faction::ENEMY;
+            shot.position = position;
+            shot.velocity = Vector2Scale(dir, AutomatonConstants::ProjectileSpeed);
+            shot.size = { AutomatonConstants::ProjectileSize, AutomatonConstants::ProjectileSize };
+            shot.lifetime = AutomatonConstants::ProjectileLifetime;
+            shot.damage = AutomatonConstants::ProjectileDamage;
+            commands.fireProjectile(shot);
         }
         shootCooldown = shootInterval;
     }
-    static int pathTimer = 0;
-    static Vector2 lastPlayerPos = {0, 0};
     float distanceToPlayer = Vector2Distance(position, playerPos);
-    float playerMoved = Vector2Distance(playerPos, lastPlayerPos);
-    if ((pathTimer++ > AutomatonConstants::PathTimerThreshold || path.empty() || playerMoved > AutomatonConstants::PlayerMovedThreshold) && !pathfindingInProgress) {
-        requestPathAsync(map, position, playerPos);
-        pathTimer = 0;
-        lastPlayerPos = playerPos;
-    }
-    if (pathReady) {
-        std::lock_guard<std::mutex> lock(pathMutex);
-        pathReady = false;
+    Vector2 flowStep;
+    if (FlowField::getInstance().nextStep(position, flowStep)) {
+        path.assign(1, flowStep);
+    } else {
+        float playerMoved = Vector2Distance(playerPos, lastRepathTarget);
+        if ((repathTimer++ > AutomatonConstants::PathTimerThreshold || path.empty() || playerMoved > AutomatonConstants::PlayerMovedThreshold) && !isPathPending()) {
+            requestPath(position, playerPos);
+            repathTimer = 0;
+            lastRepathTarget = playerPos;
+        }
+        pollPath();
     }
     if (!path.empty()) {
         Vector2 target = path.front();
         if (Vector2Distance(position, target) < AutomatonConstants::PathTargetRadius) {
-            std::lock_guard<std::mutex> lock(pathMutex);
             path.erase(path.begin());
         }
         if (!path.empty()) {
@@ -82,67 +95,4 @@ void Automaton::update(const Map& map, Vector2 playerPos, float dt) {
         velocity.x = 0;
     }
     position = nextPos;
-    updateProjectiles(dt, map);
-}
-
-void Automaton::updateProjectiles(float dt, const Map& map) {
-    for (auto& proj : projectiles) {
-        proj.update(dt, map);
-    }
-}
-
-void AutomatonProjectile::update(float dt, const Map& map) {
-    if (!active) return;
-    
-    position.x += velocity.x * dt;
-    position.y += velocity.y * dt;
-    age += dt;
-
-    int tileX = (int)(position.x / 32);
-    int tileY = (int)(position.y / 32);
-    if (map.isSolidTile(tileX, tileY)) {
-        active = false;
-        return;
-    }
-    
-    if (age > lifetime) active = false;
-}
-
-bool Automaton::hasLineOfSight(const Map& map, Vector2 start, Vector2 end) const {
-
-    int startX = static_cast<int>(start.x / 32.0f);
-    int startY = static_cast<int>(start.y / 32.0f);
-    int endX = static_cast<int>(end.x / 32.0f);
-    int endY = static_cast<int>(end.y / 32.0f);
-
-    int dx = abs(endX - startX);
-    int dy = abs(endY - startY);
-    int x = startX;
-    int y = startY;
-    int n = 1 + dx + dy;
-    int x_inc = (endX > startX) ? 1 : -1;
-    int y_inc = (endY > startY) ? 1 : -1;
-    int error = dx - dy;
-
-    dx *= 2;
-    dy *= 2;
-
-    for (; n > 0; --n) {
-
-        int tileValue = map.getTileValue(x, y);
-        if (tileValue == WALL_TILE_VALUE || 
-            tileValue == TILE_HIGHLIGHT_DELETE) {
-            return false;
-        }
-
-        if (error > 0) {
-            x += x_inc;
-            error -= dy;
-        } else {
-            y += y_inc;
-            error += dx;
-        }
-    }
-
-    return true;
 }
@@ -16,10 +16,7 @@ Detonode::Detonode(Vector2 pos)
       explosionRadius(128.0f),
       detectionRange(200.0f),
       approachDistance(64.0f),
-      blinkDuration(3.0f),
-      lineOfSightTimer(0.0f),
-      lastPlayerPosForLOS{0, 0},
-      cachedLineOfSightResult(false)
+      blinkDuration(3.0f)
 {}
 
 Detonode::Detonode(Detonode&& other) noexcept
@@ -35,10 +32,7 @@ Detonode::Detonode(Detonode&& other) noexcept
       explosionRadius(other.explosionRadius),
       detectionRange(other.detectionRange),
       approachDistance(other.approachDistance),
-      blinkDuration(other.blinkDuration),
-      lineOfSightTimer(other.lineOfSightTimer),
-      lastPlayerPosForLOS(other.lastPlayerPosForLOS),
-      cachedLineOfSightResult(other.cachedLineOfSightResult)
+      blinkDuration(other.blinkDuration)
 {}
 
 Detonode& Detonode::operator=(Detonode&& other) noexcept {
@@ -56,9 +50,6 @@ Detonode& Detonode::operator=(Detonode&& other) noexcept {
         detectionRange = other.detectionRange;
         approachDistance = other.approachDistance;
         blinkDuration = other.blinkDuration;
-        lineOfSightTimer = other.lineOfSightTimer;
-        lastPlayerPosForLOS = other.lastPlayerPosForLOS;
-        cachedLineOfSightResult = other.cachedLineOfSightResult;
     }
     return *this;
 }
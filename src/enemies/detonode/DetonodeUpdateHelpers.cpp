@@ -1,64 +1,17 @@
 #include "enemies/Detonode.hpp"
-#include "Pathfinding.hpp"
+#include "enemies/EnemyCommandBuffer.hpp"
 #include "map/Map.hpp"
-#include "core/GlobalThreadPool.hpp"
+#include "PlayerVisibility.hpp"
 #include <raymath.h>
 #include <cmath>
-#include <mutex>
 
 using namespace MapConstants;
 
-bool Detonode::hasLineOfSight(const Map& map, Vector2 start, Vector2 end) const {
-    int startX = static_cast<int>(start.x / 32.0f);
-    int startY = static_cast<int>(start.y / 32.0f);
-    int endX = static_cast<int>(end.x / 32.0f);
-    int endY = static_cast<int>(end.y / 32.0f);
-
-    int dx = abs(endX - startX);
-    int dy = abs(endY - startY);
-    int x = startX;
-    int y = startY;
-    int n = 1 + dx + dy;
-    int x_inc = (endX > startX) ? 1 : -1;
-    int y_inc = (endY > startY) ? 1 : -1;
-    int error = dx - dy;
-
-    dx *= 2;
-    dy *= 2;
-
-    for (; n > 0; --n) {
-        if (map.isSolidTile(x, y)) {
-            return false;
-        }
-
-        if (error > 0) {
-            x += x_inc;
-            error -= dy;
-        } else {
-            y += y_inc;
-            error += dx;
-        }
-    }
-
-    return true;
-}
-
-void Detonode::update(Map& map, Vector2 playerPos, float dt, class GameCamera& camera) {
+void Detonode::update(const Map& map, Vector2 playerPos, float dt, EnemyCommandBuffer& commands) {
     if (!alive) return;
 
-    // Distance-based update optimization - skip detailed updates if too far from player
+    // How often this runs for far-away Detonodes is up to AiLodScheduler.
     float distanceToPlayer = Vector2Distance(position, playerPos);
-    if (distanceToPlayer > detectionRange * 3.0f) {
-        // Minimal updates for far-away Detonodes
-        if (hitEffectTimer > 0.0f) {
-            hitEffectTimer -= dt;
-        }
-        if (invincibilityTimer > 0.0f) {
-            invincibilityTimer -= dt;
-        }
-        bobOffset += bobSpeed * dt;
-        return;
-    }
 
     if (invincibilityTimer > 0.0f) {
         invincibilityTimer -= dt;
@@ -75,20 +28,7 @@ void Detonode::update(Map& map, Vector2 playerPos, float dt, class GameCamera& c
     Vector2 renderPos = position;
     renderPos.y += sin(bobOffset) * bobAmplitude;
 
-    // Optimized line-of-sight check with caching
-    bool playerVisible;
-    lineOfSightTimer -= dt;
-    
-    // Use cached result if timer is still valid and player hasn't moved too much
-    if (lineOfSightTimer > 0.0f && Vector2Distance(playerPos, lastPlayerPosForLOS) < 32.0f) {
-        playerVisible = cachedLineOfSightResult;
-    } else {
-        // Recalculate and cache the result
-        playerVisible = hasLineOfSight(map, position, playerPos);
-        cachedLineOfSightResult = playerVisible;
-        lineOfSightTimer = lineOfSightCacheTime;
-        lastPlayerPosForLOS = playerPos;
-    }
+    bool playerVisible = PlayerVisibility::getInstance().canSeePlayer(position, RayBlocker::SOLID);
 
     switch (currentState) {
         case IDLE:
@@ -116,8 +56,7 @@ void Detonode::update(Map& map, Vector2 playerPos, float dt, class GameCamera& c
                 break;
             }
 
-            if (pathReady) {
-                std::lock_guard<std::mutex> lock(pathMutex);
+            if (pollPath()) {
                 if (!path.empty()) {
                     Vector2 targetPos = path[0];
                     Vector2 direction = Vector2Normalize(Vector2Subtract(targetPos, position));
@@ -130,18 +69,17 @@ void Detonode::update(Map& map, Vector2 playerPos, float dt, class GameCamera& c
                 } else {
                     velocity = {0, 0};
                 }
-                pathReady = false;
             }
 
             // Reduced pathfinding frequency - now every 3 seconds instead of 1
-            if (!pathfindingInProgress && stateTimer > 3.0f) {
+            if (!isPathPending() && stateTimer > 3.0f) {
                 // Skip pathfinding if player is visible and use direct approach
                 if (playerVisible && distanceToPlayer < detectionRange) {
                     Vector2 direction = Vector2Normalize(Vector2Subtract(playerPos, position));
                     velocity.x = direction.x * speed;
                     velocity.y = direction.y * speed;
                 } else {
-                    requestPathAsync(map, position, playerPos);
+                    requestPath(position, playerPos);
                 }
                 stateTimer = 0.0f;
             }
@@ -171,7 +109,7 @@ void Detonode::update(Map& map, Vector2 playerPos, float dt, class GameCamera& c
                 blinkTimer = 0.0f;
                 blinkCount++;
                 blinkInterval *= 0.8f;
-                createBlinkParticles();
+                createBlinkParticles(commands);
             }
 
             if (stateTimer >= blinkDuration) {
@@ -181,7 +119,7 @@ void Detonode::update(Map& map, Vector2 playerPos, float dt, class GameCamera& c
             break;
 
         case EXPLODING:
-            explode(map, camera);
+            explode(map, playerPos, commands);
             alive = false;
             break;
 
@@ -204,19 +142,3 @@ void Detonode::update(Map& map, Vector2 playerPos, float dt, class GameCamera& c
 
     stateTimer += dt;
 }
-
-void Detonode::requestPathAsync(const Map& map, Vector2 start, Vector2 goal) {
-    if (pathfindingInProgress) return;
-    pathfindingInProgress = true;
-    pathReady = false;
-
-    GlobalThreadPool::getInstance().getMainPool().enqueue([this, &map, start, goal]() {
-        auto newPath = FindPathAStar(map, start, goal);
-        {
-            std::lock_guard<std::mutex> lock(pathMutex);
-            path = std::move(newPath);
-        }
-        pathReady = true;
-        pathfindingInProgress = false;
-    });
-}
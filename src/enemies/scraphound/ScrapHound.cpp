@@ -1,14 +1,10 @@
 #include "enemies/ScrapHound.hpp"
-#include "Pathfinding.hpp"
 #include "map/Map.hpp"
 
 #include <raymath.h>
 
 
 #include <cmath>
-#include <thread>
-#include <mutex>
-#include <atomic>
 
 
 
@@ -74,11 +70,7 @@ ScrapHound::ScrapHound(ScrapHound&& other) noexcept
       patrolRightBound(other.patrolRightBound),
       patrolDirection(other.patrolDirection),
       playerDetectionRange(other.playerDetectionRange),
-      patrolBoundsInitialized(other.patrolBoundsInitialized)
-{
-    std::lock_guard<std::mutex> lock(other.pathMutex);
-    path = std::move(other.path);
-}
+      patrolBoundsInitialized(other.patrolBoundsInitialized) {}
 
 ScrapHound& ScrapHound::operator=(ScrapHound&& other) noexcept {
     if (this != &other) {
@@ -102,9 +94,6 @@ ScrapHound& ScrapHound::operator=(ScrapHound&& other) noexcept {
         meleeTriggerDistance = other.meleeTriggerDistance;
         meleeChargeTime = other.meleeChargeTime;
         meleeDuration = other.meleeDuration;
-        path = std::move(other.path);
-        pathfindingInProgress = other.pathfindingInProgress.load();
-        pathReady = other.pathReady.load();
         pounceAnimRadius = other.pounceAnimRadius;
         pounceAnimFade = other.pounceAnimFade;
         isPatrolling = other.isPatrolling;
@@ -117,22 +106,6 @@ ScrapHound& ScrapHound::operator=(ScrapHound&& other) noexcept {
     return *this;
 }
 
-void ScrapHound::requestPathAsync(const Map& map, Vector2 start, Vector2 goal) {
-    if (pathfindingInProgress) return;
-    pathfindingInProgress = true;
-    pathReady = false;
-
-    std::thread([this, &map, start, goal]() {
-        auto newPath = FindPathAStar(map, start, goal);
-        {
-            std::lock_guard<std::mutex> lock(pathMutex);
-            path = std::move(newPath);
-        }
-        pathReady = true;
-        pathfindingInProgress = false;
-    }).detach();
-}
-
 Rectangle ScrapHound::getHitbox() const {
     return Rectangle{
         position.x - 16.0f,
@@ -1,8 +1,8 @@
 #include "enemies/ScrapHound.hpp"
 #include "map/Map.hpp"
+#include "FlowField.hpp"
 #include <raymath.h>
 #include <cmath>
-#include <mutex>
 
 
 void ScrapHound::update(const Map& map, Vector2 playerPos, float dt) {
@@ -33,10 +33,7 @@ void ScrapHound::update(const Map& map, Vector2 playerPos, float dt) {
     if (shouldPatrol && !isPatrolling && !isPouncing && !isMeleeAttacking && !isPounceCharging && !isMeleeCharging) {
 
         isPatrolling = true;
-        {
-            std::lock_guard<std::mutex> lock(pathMutex);
-            path.clear();
-        }
+        path.clear();
     } else if (!shouldPatrol && isPatrolling) {
 
         isPatrolling = false;
@@ -104,22 +101,21 @@ void ScrapHound::update(const Map& map, Vector2 playerPos, float dt) {
             updatePatrol(map, dt);
         } else {
 
-            static int pathTimer = 0;
-            static Vector2 lastPlayerPos = {0, 0};
-            float playerMoved = Vector2Distance(playerPos, lastPlayerPos);
-            if ((pathTimer++ > 5 || path.empty() || playerMoved > 32.0f) && !pathfindingInProgress) {
-                requestPathAsync(map, position, playerPos);
-                pathTimer = 0;
-                lastPlayerPos = playerPos;
-            }
-            if (pathReady) {
-                std::lock_guard<std::mutex> lock(pathMutex);
-                pathReady = false;
+            Vector2 flowStep;
+            if (FlowField::getInstance().nextStep(position, flowStep)) {
+                path.assign(1, flowStep);
+            } else {
+                float playerMoved = Vector2Distance(playerPos, lastRepathTarget);
+                if ((repathTimer++ > 5 || path.empty() || playerMoved > 32.0f) && !isPathPending()) {
+                    requestPath(position, playerPos);
+                    repathTimer = 0;
+                    lastRepathTarget = playerPos;
+                }
+                pollPath();
             }
             if (!path.empty()) {
                 Vector2 target = path.front();
                 if (Vector2Distance(position, target) < 16.0f) {
-                    std::lock_guard<std::mutex> lock(pathMutex);
                     path.erase(path.begin());
                 }
                 if (!path.empty()) {
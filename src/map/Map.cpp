@@ -1,11 +1,15 @@
 #include "map/Map.hpp"
 #include "map/RoomGenerator.hpp"
-#include "core/GlobalThreadPool.hpp"
+#include "map/NavHierarchy.hpp"
+#include "map/NavGraph.hpp"
+#include "map/TileMask.hpp"
+#include "map/Raycaster.hpp"
+#include "core/Parallel.hpp"
+#include "core/RngService.hpp"
+#include "effects/ParticleSystem.hpp"
 #include <cstdio>
 #include <vector>
 #include <random> 
-#include <future>
-#include <thread>
 #include <cmath>
 #include <algorithm>
 
@@ -17,9 +21,6 @@
 namespace MapConstants {
     constexpr int BORDER_TILE_VALUE = 1;
     constexpr int CHUNK_SIZE = 16;
-    constexpr size_t MAX_PARTICLES = 160;
-    constexpr float GRAVITY_MULTIPLIER = 200.0f;
-    constexpr float DAMPING = 0.98f;
     constexpr int POP_PARTICLE_COUNT = 5;
     constexpr int SUCTION_PARTICLE_COUNT = 4;
     constexpr float POP_SPEED_MIN = 50.0f;
@@ -56,69 +57,37 @@ Map::Map(int w, int h, const std::vector<Texture2D>& loadedTileTextures, Progres
 {
     try {
         if (progressCallback) progressCallback(0.0f);
-        std::random_device rd;
-        std::mt19937 gen(rd());        
-        size_t numThreads = std::thread::hardware_concurrency();
-        if (numThreads == 0) numThreads = 2;
-        
-        size_t totalTiles = width * height;
-        size_t tilesPerThread = (totalTiles + numThreads - 1) / numThreads;
-        std::vector<std::future<void>> futures;
-        
-        try {
-            for (size_t t = 0; t < numThreads; ++t) {
-                size_t startTile = t * tilesPerThread;
-                size_t endTile = std::min(startTile + tilesPerThread, totalTiles);
-                
-                if (startTile < endTile) {
-                    futures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue([&, startTile, endTile]() {
-                        for (size_t tileIdx = startTile; tileIdx < endTile; ++tileIdx) {
-                            int x = tileIdx % width;
-                            int y = tileIdx / width;
-                            tiles[x][y] = 0;
-                            isOriginalSolid[x][y] = false;
-                            isConwayProtected[x][y] = false;
-                        }
-                    }));
-                }
-            }
-            for (auto& f : futures) f.get();
-        } catch (...) {
-
-            for (int x = 0; x < width; ++x) {
-                for (int y = 0; y < height; ++y) {
-                    tiles[x][y] = 0;
-                    isOriginalSolid[x][y] = false;
-                    isConwayProtected[x][y] = false;
-                }
+        // Room layout still runs on mt19937 through the generator APIs, seeded
+        // from the run seed so a seed reproduces the map.
+        std::mt19937 gen(static_cast<std::mt19937::result_type>(
+            RngService::getInstance().stream(RngStream::MAP_GENERATION).next()));
+        automataRng = RngService::getInstance().stream(RngStream::AUTOMATA);
+        // Slices own whole columns: tiles[x] and the vector<bool> rows are
+        // never shared between threads.
+        parallel_for(0, width, [&](size_t xBegin, size_t xEnd) {
+            for (size_t x = xBegin; x < xEnd; ++x) {
+                std::fill(tiles[x].begin(), tiles[x].end(), 0);
+                std::fill(isOriginalSolid[x].begin(), isOriginalSolid[x].end(), false);
+                std::fill(isConwayProtected[x].begin(), isConwayProtected[x].end(), false);
             }
-        }
+        });
 
         if (progressCallback) progressCallback(0.15f);
 
 
-        std::vector<std::future<void>> borderFutures;
-
-        borderFutures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue([&]() {
-            for (int x = 0; x < width; x++) {
-                tiles[x][height - 1] = BORDER_TILE_VALUE; 
-                isOriginalSolid[x][height - 1] = true;
-                tiles[x][0] = BORDER_TILE_VALUE;         
-                isOriginalSolid[x][0] = true;
-            }
-        }));
- 
-        borderFutures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue([&]() {
-            for (int y = 0; y < height; y++) {
-                tiles[width - 1][y] = BORDER_TILE_VALUE; 
-                isOriginalSolid[width - 1][y] = true;
-                tiles[0][y] = BORDER_TILE_VALUE;
-                isOriginalSolid[0][y] = true;
-            }
-        }));
-
-        for (auto& future : borderFutures) {
-            future.get();
+        // Too small to be worth splitting, and both edges touch the corner words
+        // of the vector<bool> columns.
+        for (int x = 0; x < width; x++) {
+            tiles[x][height - 1] = BORDER_TILE_VALUE; 
+            isOriginalSolid[x][height - 1] = true;
+            tiles[x][0] = BORDER_TILE_VALUE;         
+            isOriginalSolid[x][0] = true;
+        }
+        for (int y = 0; y < height; y++) {
+            tiles[width - 1][y] = BORDER_TILE_VALUE; 
+            isOriginalSolid[width - 1][y] = true;
+            tiles[0][y] = BORDER_TILE_VALUE;
+            isOriginalSolid[0][y] = true;
         }
 
         if (progressCallback) progressCallback(0.25f);
@@ -142,53 +111,27 @@ Map::Map(int w, int h, const std::vector<Texture2D>& loadedTileTextures, Progres
         if (progressCallback) progressCallback(0.35f);
 
         
-        std::vector<std::future<void>> conwayFutures;
-        
-        try {
-            for (size_t t = 0; t < numThreads; ++t) {
-                size_t startTile = t * tilesPerThread;
-                size_t endTile = std::min(startTile + tilesPerThread, totalTiles);
-                
-                if (startTile < endTile) {
-                    conwayFutures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue([&, startTile, endTile]() {
-                        for (size_t tileIdx = startTile; tileIdx < endTile; ++tileIdx) {
-                            int x = tileIdx % width;
-                            int y = tileIdx / width;
-                            if (isOriginalSolid[x][y]) {
-                                for (int dx = -2; dx <= 2; ++dx) {
-                                    for (int dy = -2; dy <= 2; ++dy) {
-                                        int nx = x + dx;
-                                        int ny = y + dy;
-                                        if (nx >= 0 && nx < width && ny >= 0 && ny < height) {
-                                            isConwayProtected[nx][ny] = true;
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }));
-                }
-            }
-            for (auto& f : conwayFutures) f.get();
-        } catch (...) {
-
-            for (int x = 0; x < width; ++x) {
+        // Gather rather than scatter so each slice only writes its own columns.
+        parallel_for(0, width, [&](size_t xBegin, size_t xEnd) {
+            for (int x = static_cast<int>(xBegin); x < static_cast<int>(xEnd); ++x) {
                 for (int y = 0; y < height; ++y) {
-                    if (isOriginalSolid[x][y]) {
-                        for (int dx = -2; dx <= 2; ++dx) {
-                            for (int dy = -2; dy <= 2; ++dy) {
-                                int nx = x + dx;
-                                int ny = y + dy;
-                                if (nx >= 0 && nx < width && ny >= 0 && ny < height) {
-                                    isConwayProtected[nx][ny] = true;
-                                }
+                    bool nearSolid = false;
+                    for (int dx = -2; dx <= 2 && !nearSolid; ++dx) {
+                        for (int dy = -2; dy <= 2; ++dy) {
+                            int nx = x + dx;
+                            int ny = y + dy;
+                            if (nx >= 0 && nx < width && ny >= 0 && ny < height && isOriginalSolid[nx][ny]) {
+                                nearSolid = true;
+                                break;
                             }
                         }
                     }
+                    if (nearSolid) {
+                        isConwayProtected[x][y] = true;
+                    }
                 }
             }
-        }
-        
+        });
 
         if (progressCallback) progressCallback(0.55f);
 
@@ -196,6 +139,16 @@ Map::Map(int w, int h, const std::vector<Texture2D>& loadedTileTextures, Progres
         RoomGenerator::generateRoomsAndConnections(*this, gen, progressCallback);
         printf("[Map] Room generation complete\n");
 
+        navHierarchy = std::make_unique<NavHierarchy>();
+        navHierarchy->build(*this);
+        printf("[Map] Navigation hierarchy: %zu entrance nodes\n", navHierarchy->getNodeCount());
+        navGraph = std::make_unique<NavGraph>();
+        navGraph->build(*this);
+        printf("[Map] Navigation graph: %zu spans\n", navGraph->getSpanCount());
+        tileMask = std::make_unique<TileMask>();
+        tileMask->build(*this);
+        raycaster = std::make_unique<Raycaster>(*tileMask);
+
         if (progressCallback) progressCallback(1.0f);
         printf("[Map] Map generation fully complete\n");
     } catch (...) {
@@ -225,47 +178,25 @@ Map::~Map() {
     
 }
 
-void Map::updateParticles(float dt, Vector2 playerPosition) {
-    std::lock_guard<std::mutex> lock(particlesMutex);
-    
-    if (particles.size() > MAX_PARTICLES) {
-        std::sort(particles.begin(), particles.end(), [&playerPosition](const auto& a, const auto& b) {
-            float distA = (a.position.x - playerPosition.x) * (a.position.x - playerPosition.x) + 
-                         (a.position.y - playerPosition.y) * (a.position.y - playerPosition.y);
-            float distB = (b.position.x - playerPosition.x) * (b.position.x - playerPosition.x) + 
-                         (b.position.y - playerPosition.y) * (b.position.y - playerPosition.y);
-            return distA < distB;
-        });
-        particles.erase(particles.begin() + MAX_PARTICLES, particles.end());
+void Map::markNavDirty(int x, int y) {
+    if (navGraph) {
+        navGraph->markDirty(x, y);
     }
-    
-    const float gravity = GRAVITY_MULTIPLIER * dt;
-    const float damping = DAMPING;
-    
-    for (auto it = particles.begin(); it != particles.end();) {
-        it->life -= dt;
-        if (it->life <= 0) {
-            it = particles.erase(it);
-        } else {
-            it->position.x += it->velocity.x * dt;
-            it->position.y += it->velocity.y * dt;
-            it->velocity.x *= damping;
-            it->velocity.y = it->velocity.y * damping + gravity;
-            float alpha = it->life / it->maxLife;
-            it->color.a = (unsigned char)(255 * alpha);
-            ++it;
-        }
+    if (tileMask) {
+        tileMask->markDirty(x, y);
     }
 }
 
-void Map::createPopEffect(Vector2 position) {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * M_PI);
-    std::uniform_real_distribution<float> speedDist(POP_SPEED_MIN, POP_SPEED_MAX);
-    std::uniform_real_distribution<float> sizeDist(POP_SIZE_MIN, POP_SIZE_MAX);
-    std::uniform_real_distribution<float> lifeDist(POP_LIFE_MIN, POP_LIFE_MAX);
-    
+void Map::repairNavGraph() {
+    if (navGraph) {
+        navGraph->repair(*this);
+    }
+    if (tileMask) {
+        tileMask->repair(*this);
+    }
+}
+
+void Map::createPopEffect(Vector2 position, FastRNG& rng) {
     static const Color colors[] = {
         {255, 100, 100, 255},
         {100, 255, 100, 255},
@@ -274,27 +205,18 @@ void Map::createPopEffect(Vector2 position) {
         {255, 100, 255, 255}
     };
     
-    std::lock_guard<std::mutex> lock(particlesMutex);
-    particles.reserve(particles.size() + POP_PARTICLE_COUNT);
+    Particle batch[POP_PARTICLE_COUNT];
     for (int i = 0; i < POP_PARTICLE_COUNT; ++i) {
-        float angle = angleDist(gen);
-        float speed = speedDist(gen);
-        Vector2 velocity = {cosf(angle) * speed, sinf(angle) * speed};
-        float size = sizeDist(gen);
-        float life = lifeDist(gen);
-        Color color = colors[i];
-        particles.emplace_back(position, velocity, color, life, size);
+        float angle = rng.nextFloat(0.0f, 2.0f * M_PI);
+        float speed = rng.nextFloat(POP_SPEED_MIN, POP_SPEED_MAX);
+        float life = rng.nextFloat(POP_LIFE_MIN, POP_LIFE_MAX);
+        float size = rng.nextFloat(POP_SIZE_MIN, POP_SIZE_MAX);
+        batch[i] = { position, {cosf(angle) * speed, sinf(angle) * speed}, colors[i], life, life, size, ParticlePriority::AMBIENT };
     }
+    ParticleSystem::getInstance().emit(batch, POP_PARTICLE_COUNT);
 }
 
-void Map::createSuctionEffect(Vector2 position) {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * M_PI);
-    std::uniform_real_distribution<float> radiusDist(SUCTION_RADIUS_MIN, SUCTION_RADIUS_MAX);
-    std::uniform_real_distribution<float> sizeDist(SUCTION_SIZE_MIN, SUCTION_SIZE_MAX);
-    std::uniform_real_distribution<float> lifeDist(SUCTION_LIFE_MIN, SUCTION_LIFE_MAX);
-    
+void Map::createSuctionEffect(Vector2 position, FastRNG& rng) {
     static const Color colors[] = {
         {200, 50, 50, 255},
         {50, 50, 200, 255},
@@ -302,11 +224,10 @@ void Map::createSuctionEffect(Vector2 position) {
         {200, 50, 200, 255}
     };
     
-    std::lock_guard<std::mutex> lock(particlesMutex);
-    particles.reserve(particles.size() + SUCTION_PARTICLE_COUNT);
+    Particle batch[SUCTION_PARTICLE_COUNT];
     for (int i = 0; i < SUCTION_PARTICLE_COUNT; ++i) {
-        float angle = angleDist(gen);
-        float radius = radiusDist(gen);
+        float angle = rng.nextFloat(0.0f, 2.0f * M_PI);
+        float radius = rng.nextFloat(SUCTION_RADIUS_MIN, SUCTION_RADIUS_MAX);
         Vector2 startPos = {
             position.x + cosf(angle) * radius,
             position.y + sinf(angle) * radius
@@ -315,15 +236,16 @@ void Map::createSuctionEffect(Vector2 position) {
             (position.x - startPos.x) * SUCTION_VEL_MULT,
             (position.y - startPos.y) * SUCTION_VEL_MULT
         };
-        float size = sizeDist(gen);
-        float life = lifeDist(gen);
-        Color color = colors[i];
-        particles.emplace_back(startPos, velocity, color, life, size);
+        float life = rng.nextFloat(SUCTION_LIFE_MIN, SUCTION_LIFE_MAX);
+        float size = rng.nextFloat(SUCTION_SIZE_MIN, SUCTION_SIZE_MAX);
+        batch[i] = { startPos, velocity, colors[i], life, life, size, ParticlePriority::AMBIENT };
     }
+    ParticleSystem::getInstance().emit(batch, SUCTION_PARTICLE_COUNT);
 }
 
 void Map::setTileValue(int x, int y, int value) {
     if (x >= 0 && x < width && y >= 0 && y < height) {
         tiles[x][y] = value;
+        markNavDirty(x, y);
     }
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "map/Map.hpp"
+#include "core/Parallel.hpp"
 #include <random>
 #include <algorithm>
-#include <thread>
 
 #include <atomic>
 
@@ -41,17 +41,11 @@ void Map::applyConwayAutomata() {
     }
     
     std::vector<std::vector<int>> nextTiles = tiles;
-    std::random_device rd;
-    int numThreads = std::min(8, (int)std::thread::hardware_concurrency());
-    
-    std::vector<std::mt19937> gens;
-    gens.reserve(numThreads);
-    for (int t = 0; t < numThreads; ++t) gens.emplace_back(rd());
     
     std::vector<std::pair<int, int>> candidateChunks;
     candidateChunks.reserve(width * height / 16);
     
-    std::mt19937 masterGen(rd());
+    FastRNG& masterGen = automataRng;
     std::uniform_int_distribution<> chunkSizeDist(MIN_CONWAY_CHUNK_SIZE_X, MAX_CONWAY_CHUNK_SIZE_X);
     std::uniform_int_distribution<> chunkYSizeDist(MIN_CONWAY_CHUNK_SIZE_Y, MAX_CONWAY_CHUNK_SIZE_Y);
     std::uniform_int_distribution<> shouldChunkBeAliveDist(0, CHUNK_ALIVE_ROLL_MAX + 3);
@@ -90,143 +84,142 @@ void Map::applyConwayAutomata() {
     candidateChunks.resize(maxChunks);
     
     std::atomic<int> createdCount(0), deletedCount(0), processedChunks(0);
-    std::vector<std::thread> threads;
-    threads.reserve(numThreads);
-    
-    size_t chunksPerThread = (candidateChunks.size() + numThreads - 1) / numThreads;
+    uint64_t chunkSeed = masterGen.next();
     
-    for (int t = 0; t < numThreads; ++t) {
-        size_t start = t * chunksPerThread;
-        size_t end = std::min(start + chunksPerThread, candidateChunks.size());
-        if (start >= end) break;
+    parallel_for(0, candidateChunks.size(), [&](size_t start, size_t end) {
+        auto aliveDist = shouldChunkBeAliveDist;
+        auto widthDist = chunkSizeDist;
+        auto heightDist = chunkYSizeDist;
+        int localCreated = 0, localDeleted = 0;
         
-        threads.emplace_back([&, t, start, end]() {
-            auto& gen = gens[t];
-            int localCreated = 0, localDeleted = 0;
+        for (size_t i = start; i < end; ++i) {
+            int x = candidateChunks[i].first;
+            int y = candidateChunks[i].second;
+            // Seeded per chunk: slice bounds depend on the worker count.
+            FastRNG gen((chunkSeed ^ (static_cast<uint64_t>(i) * 0x9e3779b97f4a7c15ULL)) | 1);
             
-            for (size_t i = start; i < end; ++i) {
-                int x = candidateChunks[i].first;
-                int y = candidateChunks[i].second;
-                
-                bool shouldCreate = (shouldChunkBeAliveDist(gen) == CHUNK_ALIVE_SUCCESS_ROLL);
-                int chunkW = chunkSizeDist(gen);
-                int chunkH = chunkYSizeDist(gen);
-                
-                for (int cy = y; cy < std::min(y + chunkH, height); ++cy) {
-                    for (int cx = x; cx < std::min(x + chunkW, width); ++cx) {
-                        if (isConwayProtected[cx][cy] || cooldownMap[cx][cy] > 0) continue;
+            bool shouldCreate = (aliveDist(gen) == CHUNK_ALIVE_SUCCESS_ROLL);
+            int chunkW = widthDist(gen);
+            int chunkH = heightDist(gen);
+            
+            for (int cy = y; cy < std::min(y + chunkH, height); ++cy) {
+                for (int cx = x; cx < std::min(x + chunkW, width); ++cx) {
+                    if (isConwayProtected[cx][cy] || cooldownMap[cx][cy] > 0) continue;
+                    
+                    bool isSolid = (tiles[cx][cy] == TILE_ID_SOLID || tiles[cx][cy] == TILE_ID_PLATFORM);
+                    
+                    if (shouldCreate && !isSolid) {
+                        nextTiles[cx][cy] = TILE_HIGHLIGHT_CREATE;
+                        transitionTimers[cx][cy] = 0.0f;
+                        cooldownMap[cx][cy] = CHUNK_COOLDOWN_FRAMES;
                         
-                        bool isSolid = (tiles[cx][cy] == TILE_ID_SOLID || tiles[cx][cy] == TILE_ID_PLATFORM);
+                        localCreated++;
+                    } else if (!shouldCreate && isSolid) {
+                        nextTiles[cx][cy] = TILE_HIGHLIGHT_DELETE;
+                        transitionTimers[cx][cy] = 0.0f;
+                        cooldownMap[cx][cy] = CHUNK_COOLDOWN_FRAMES;
                         
-                        if (shouldCreate && !isSolid) {
-                            nextTiles[cx][cy] = TILE_HIGHLIGHT_CREATE;
-                            transitionTimers[cx][cy] = 0.0f;
-                            cooldownMap[cx][cy] = CHUNK_COOLDOWN_FRAMES;
-                            
-                            localCreated++;
-                        } else if (!shouldCreate && isSolid) {
-                            nextTiles[cx][cy] = TILE_HIGHLIGHT_DELETE;
-                            transitionTimers[cx][cy] = 0.0f;
-                            cooldownMap[cx][cy] = CHUNK_COOLDOWN_FRAMES;
-                            
-                            localDeleted++;
-                        }
+                        localDeleted++;
                     }
                 }
-                processedChunks++;
             }
-            
-            createdCount += localCreated;
-            deletedCount += localDeleted;
-        });
+            processedChunks++;
+        }
+        
+        createdCount += localCreated;
+        deletedCount += localDeleted;
+    });
+    // Highlights change walkability and opacity (a ladder, rope or lava cell
+    // can become HIGHLIGHT_CREATE, a platform HIGHLIGHT_DELETE), so the nav
+    // graph and tile mask must hear about them now, not when they settle.
+    for (int x = 0; x < width; ++x) {
+        if (nextTiles[x] == tiles[x]) continue;
+        for (int y = 0; y < height; ++y) {
+            if (nextTiles[x][y] != tiles[x][y]) {
+                markNavDirty(x, y);
+            }
+        }
     }
-    
-    for (auto& th : threads) th.join();
-    tiles = nextTiles;
+    tiles = std::move(nextTiles);
     printf("[ConwayAutomata] Processed: %d chunks, Created: %d, Deleted: %d\n", 
            processedChunks.load(), createdCount.load(), deletedCount.load());
 }
 
 void Map::updateTransitions(float dt) {
-    int numThreads = std::thread::hardware_concurrency();
-    int chunkSize = (height - 2 + numThreads - 1) / numThreads;
-    std::vector<std::thread> threads;
-    std::random_device rd;
-    std::vector<std::mt19937> gens;
-    for (int t = 0; t < numThreads; ++t) gens.emplace_back(rd());
-    for (int t = 0; t < numThreads; ++t) {
-        int yStart = 1 + t * chunkSize;
-        int yEnd = std::min(height - 1, yStart + chunkSize);
-        threads.emplace_back([&, t, yStart, yEnd]() {
-            auto& gen = gens[t];
-            std::uniform_int_distribution<> tileChoiceDist(0, 1);
-            std::vector<int> batchChoices(width * (yEnd - yStart));
-            for (auto& v : batchChoices) v = tileChoiceDist(gen);
-            int batchIdx = 0;
-            for (int x = 1; x < width - 1; ++x) {
-                for (int y = yStart; y < yEnd; ++y) {
-                    if (cooldownMap[x][y] > 0) {
-                        cooldownMap[x][y]--;
+    // Runs every frame, so slices own whole columns (the vector<bool> rows
+    // are packed per column). Each column draws from its own cheap FastRNG,
+    // seeded by index so the result doesn't depend on how columns are sliced.
+    uint64_t frameSeed = automataRng.next();
+
+    parallel_for(1, width - 1, [&](size_t xBegin, size_t xEnd) {
+        for (int x = static_cast<int>(xBegin); x < static_cast<int>(xEnd); ++x) {
+            FastRNG rng((frameSeed ^ (static_cast<uint64_t>(x) * 0x9e3779b97f4a7c15ULL)) | 1);
+            for (int y = 1; y < height - 1; ++y) {
+                if (cooldownMap[x][y] > 0) {
+                    cooldownMap[x][y]--;
+                }
+                if (isConwayProtected[x][y]) {
+                    int original = isOriginalSolid[x][y] ? TILE_ID_SOLID : TILE_ID_EMPTY;
+                    // Runs for every protected tile each frame; only flag real changes.
+                    if (tiles[x][y] != original) {
+                        tiles[x][y] = original;
+                        markNavDirty(x, y);
                     }
-                    if (isConwayProtected[x][y]) {
-                        if (isOriginalSolid[x][y]) {
-                            tiles[x][y] = TILE_ID_SOLID;
+                    transitionTimers[x][y] = 0.0f;
+                    continue;
+                }
+                if (tiles[x][y] == TILE_HIGHLIGHT_CREATE) {
+                    float timer = transitionTimers[x][y] + dt;
+                    if (timer >= HIGHLIGHT_TIME) {
+                        if ((rng.next() & 1) == 0) {
+                            tiles[x][y] = TILE_ID_TEMP_CREATE_A;
                         } else {
-                            tiles[x][y] = TILE_ID_EMPTY;
+                            tiles[x][y] = TILE_ID_TEMP_CREATE_B;
                         }
+                        createPopEffect({(float)(x * 32 + 16), (float)(y * 32 + 16)}, rng);
+                        markNavDirty(x, y);
                         transitionTimers[x][y] = 0.0f;
-                        continue;
+                    } else {
+                        transitionTimers[x][y] = timer;
                     }
-                    if (tiles[x][y] == TILE_HIGHLIGHT_CREATE) {
-                        float timer = transitionTimers[x][y] + dt;
-                        if (timer >= HIGHLIGHT_TIME) {
-                            if (batchChoices[batchIdx++] == 0) {
-                                tiles[x][y] = TILE_ID_TEMP_CREATE_A;
-                            } else {
-                                tiles[x][y] = TILE_ID_TEMP_CREATE_B;
-                            }
-                            createPopEffect({(float)(x * 32 + 16), (float)(y * 32 + 16)});
-                            transitionTimers[x][y] = 0.0f;
-                        } else {
-                            transitionTimers[x][y] = timer;
-                        }
-                    } else if (tiles[x][y] == TILE_HIGHLIGHT_DELETE) {
-                        float timer = transitionTimers[x][y] + dt;
-                        if (timer >= HIGHLIGHT_TIME) {
-                            createSuctionEffect({(float)(x * 32 + 16), (float)(y * 32 + 16)});
-                            tiles[x][y] = TILE_ID_TEMP_DELETE;
-                            transitionTimers[x][y] = 0.0f;
-                        } else {
-                            transitionTimers[x][y] = timer;
-                        }
-                    } else if (tiles[x][y] == TILE_ID_TEMP_CREATE_A || tiles[x][y] == TILE_ID_TEMP_CREATE_B) {
-                        float timer = transitionTimers[x][y] + dt;
-                        if (timer >= GLITCH_TIME) {
-                            if (tiles[x][y] == TILE_ID_TEMP_CREATE_A) {
-                                tiles[x][y] = TILE_ID_PLATFORM;
-                                isOriginalSolid[x][y] = false;
-                                isConwayProtected[x][y] = false;
-                            } else if (tiles[x][y] == TILE_ID_TEMP_CREATE_B) {
-                                tiles[x][y] = TILE_ID_PLATFORM;
-                                isOriginalSolid[x][y] = false;
-                                isConwayProtected[x][y] = false;
-                            }
-                            transitionTimers[x][y] = 0.0f;
-                        } else {
-                            transitionTimers[x][y] = timer;
-                        }
-                    } else if (tiles[x][y] == TILE_ID_TEMP_DELETE) {
-                        float timer = transitionTimers[x][y] + dt;
-                        if (timer >= GLITCH_TIME) {
-                            tiles[x][y] = TILE_ID_EMPTY;
-                            transitionTimers[x][y] = 0.0f;
-                        } else {
-                            transitionTimers[x][y] = timer;
+                } else if (tiles[x][y] == TILE_HIGHLIGHT_DELETE) {
+                    float timer = transitionTimers[x][y] + dt;
+                    if (timer >= HIGHLIGHT_TIME) {
+                        createSuctionEffect({(float)(x * 32 + 16), (float)(y * 32 + 16)}, rng);
+                        tiles[x][y] = TILE_ID_TEMP_DELETE;
+                        markNavDirty(x, y);
+                        transitionTimers[x][y] = 0.0f;
+                    } else {
+                        transitionTimers[x][y] = timer;
+                    }
+                } else if (tiles[x][y] == TILE_ID_TEMP_CREATE_A || tiles[x][y] == TILE_ID_TEMP_CREATE_B) {
+                    float timer = transitionTimers[x][y] + dt;
+                    if (timer >= GLITCH_TIME) {
+                        if (tiles[x][y] == TILE_ID_TEMP_CREATE_A) {
+                            tiles[x][y] = TILE_ID_PLATFORM;
+                            isOriginalSolid[x][y] = false;
+                            isConwayProtected[x][y] = false;
+                        } else if (tiles[x][y] == TILE_ID_TEMP_CREATE_B) {
+                            tiles[x][y] = TILE_ID_PLATFORM;
+                            isOriginalSolid[x][y] = false;
+                            isConwayProtected[x][y] = false;
                         }
+                        markNavDirty(x, y);
+                        transitionTimers[x][y] = 0.0f;
+                    } else {
+                        transitionTimers[x][y] = timer;
+                    }
+                } else if (tiles[x][y] == TILE_ID_TEMP_DELETE) {
+                    float timer = transitionTimers[x][y] + dt;
+                    if (timer >= GLITCH_TIME) {
+                        tiles[x][y] = TILE_ID_EMPTY;
+                        markNavDirty(x, y);
+                        transitionTimers[x][y] = 0.0f;
+                    } else {
+                        transitionTimers[x][y] = timer;
                     }
                 }
             }
-        });
-    }
-    for (auto& th : threads) th.join();
+        }
+    });
 }
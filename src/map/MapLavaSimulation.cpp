@@ -74,6 +74,7 @@ void Map::updateLavaFlow(float dt) {
                              belowTile == LADDER_TILE_VALUE || belowTile == ROPE_TILE_VALUE) && 
                             newMass[x][belowY] > LAVA_MIN_MASS) {
                             tiles[x][belowY] = LAVA_TILE_VALUE;
+                            markNavDirty(x, belowY);
                             isOriginalSolid[x][belowY] = false;
                         }
                     }
@@ -145,6 +146,7 @@ void Map::updateLavaFlow(float dt) {
                                      neighborTile == LADDER_TILE_VALUE || neighborTile == ROPE_TILE_VALUE) && 
                                     flowAmount > LAVA_MIN_MASS) {
                                     tiles[neighborX][y] = LAVA_TILE_VALUE;
+                                    markNavDirty(neighborX, y);
                                     isOriginalSolid[neighborX][y] = false;
                                 }
                             }
@@ -183,6 +185,7 @@ void Map::updateLavaFlow(float dt) {
                                 newFlow[neighborX][y] = std::max(newFlow[neighborX][y], spreadAmount);
                                 
                                 tiles[neighborX][y] = LAVA_TILE_VALUE;
+                                markNavDirty(neighborX, y);
                                 isOriginalSolid[neighborX][y] = false;
                             }
                         }
@@ -204,6 +207,7 @@ void Map::updateLavaFlow(float dt) {
                 
                 if (newMass[x][y] < LAVA_MIN_MASS * 0.15f) {
                     tiles[x][y] = EMPTY_TILE_VALUE;
+                    markNavDirty(x, y);
                     newMass[x][y] = 0.0f;
                     newFlow[x][y] = 0.0f;
                 }
@@ -96,9 +96,6 @@ void Map::draw(const Camera2D& camera) const {
     
     static std::vector<TileBatch> tileBatches;
     static std::vector<RectBatch> rectBatches;
-    static std::vector<Vector2> circlePositions;
-    static std::vector<float> circleSizes;
-    static std::vector<Color> circleColors;
     
     if (tileBatches.size() < tileTextures.size()) {
         tileBatches.resize(tileTextures.size());
@@ -111,9 +108,6 @@ void Map::draw(const Camera2D& camera) const {
     rectBatches.clear();
     rectBatches.resize(7);
     
-    circlePositions.clear();
-    circleSizes.clear();
-    circleColors.clear();
 
     int renderedChunks = 0;
     for (const auto& chunk : chunks) {
@@ -213,28 +207,5 @@ void Map::draw(const Camera2D& camera) const {
             DrawRectangleRec(batch.rects[i], batch.colors[i]);
         }
     }
-    
-    {
-        std::lock_guard<std::mutex> lock(particlesMutex);
-        
-        int visibleCount = 0;
-        for (const auto& particle : particles) {
-            if (particle.position.x >= visibleWorldRect.x - 32 && 
-                particle.position.x <= visibleWorldRect.x + visibleWorldRect.width + 32 &&
-                particle.position.y >= visibleWorldRect.y - 32 && 
-                particle.position.y <= visibleWorldRect.y + visibleWorldRect.height + 32) {
-                visibleCount++;
-                
-                circlePositions.push_back(particle.position);
-                circleSizes.push_back(particle.size);
-                circleColors.push_back(particle.color);
-            }
-        }
-        
-        for (size_t i = 0; i < circlePositions.size(); ++i) {
-            DrawCircleV(circlePositions[i], circleSizes[i], circleColors[i]);
-        }
-    }
-
 }
 
@@ -0,0 +1,448 @@
+#include "map/NavGraph.hpp"
+#include "map/Map.hpp"
+#include "core/Parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+    constexpr float JUMP_COST = 2.0f;
+    constexpr float CLIMB_COST = 1.0f;
+
+    bool IsPassable(const Map& map, int x, int y) {
+        return map.isInsideBounds(x, y) && !map.isSolidTile(x, y) && !map.isLavaTile(x, y);
+    }
+
+    bool IsStandable(const Map& map, int x, int y) {
+        return IsPassable(map, x, y) && map.isSolidTile(x, y + 1);
+    }
+
+    bool IsClimbable(const Map& map, int x, int y) {
+        return map.isLadderTile(x, y) || map.isRopeTile(x, y);
+    }
+
+    // Conservative box arc: straight up from the take-off to one row above
+    // the higher end, across, then straight down onto the landing.
+    bool IsArcClear(const Map& map, int tx, int ty, int lx, int ly) {
+        int apex = std::min(ty, ly) - 1;
+        if (apex < 0) return false;
+        for (int y = apex; y < ty; ++y) {
+            if (!IsPassable(map, tx, y)) return false;
+        }
+        int step = lx > tx ? 1 : -1;
+        for (int x = tx; x != lx; x += step) {
+            if (!IsPassable(map, x, apex)) return false;
+        }
+        for (int y = apex; y <= ly; ++y) {
+            if (!IsPassable(map, lx, y)) return false;
+        }
+        return true;
+    }
+
+    struct OpenEntry {
+        float f;
+        float g;
+        int32_t index;
+    };
+
+    struct OpenEntryGreater {
+        bool operator()(const OpenEntry& a, const OpenEntry& b) const {
+            if (a.f != b.f) return a.f > b.f;
+            return a.g < b.g;
+        }
+    };
+
+    struct SpanSearchScratch {
+        uint32_t generation = 0;
+        std::vector<uint32_t> stamp;
+        std::vector<float> gScore;
+        std::vector<int32_t> parent;
+        std::vector<int32_t> parentEdge;
+        std::vector<int16_t> entryX;  // where the best route so far lands on the span
+        std::vector<OpenEntry> open;
+        std::vector<int32_t> route;
+
+        void begin(size_t count) {
+            if (stamp.size() < count) {
+                stamp.assign(count, 0);
+                gScore.resize(count);
+                parent.resize(count);
+                parentEdge.resize(count);
+                entryX.resize(count);
+                generation = 0;
+            }
+            if (++generation == 0) {
+                std::fill(stamp.begin(), stamp.end(), 0);
+                generation = 1;
+            }
+            open.clear();
+        }
+    };
+
+    thread_local SpanSearchScratch spanScratch;
+}
+
+size_t NavGraph::getSpanCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return liveSpans;
+}
+
+int32_t NavGraph::spanAtCell(int x, int y) const {
+    if (x < 0 || y < 0 || x >= width || y >= height) return -1;
+    return spanAt[static_cast<size_t>(x) * height + y];
+}
+
+void NavGraph::build(const Map& map) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    width = map.getWidth();
+    height = map.getHeight();
+    chunksWide = (width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunksHigh = (height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    size_t chunkCount = static_cast<size_t>(chunksWide) * chunksHigh;
+
+    spans.clear();
+    freeSpans.clear();
+    liveSpans = 0;
+    chunkSpans.assign(chunkCount, {});
+    spanAt.assign(static_cast<size_t>(width) * height, -1);
+    dirtyChunks = std::make_unique<std::atomic<uint8_t>[]>(chunkCount);
+    chunkRevision = std::make_unique<std::atomic<uint64_t>[]>(chunkCount);
+    for (size_t c = 0; c < chunkCount; ++c) {
+        dirtyChunks[c].store(0, std::memory_order_relaxed);
+        chunkRevision[c].store(0, std::memory_order_relaxed);
+    }
+    revision = 0;
+    anyDirty.store(false, std::memory_order_relaxed);
+
+    for (size_t c = 0; c < chunkCount; ++c) {
+        rebuildChunkSpans(map, static_cast<int>(c));
+    }
+    // Links only write their own span's edge list.
+    parallel_for(0, chunkCount, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            for (int32_t index : chunkSpans[c]) {
+                rebuildLinks(map, index);
+            }
+        }
+    });
+}
+
+void NavGraph::markDirty(int x, int y) {
+    if (!dirtyChunks || x < 0 || y < 0 || x >= width || y >= height) return;
+    dirtyChunks[chunkOf(x, y)].store(1, std::memory_order_relaxed);
+    if (y > 0) {
+        dirtyChunks[chunkOf(x, y - 1)].store(1, std::memory_order_relaxed);
+    }
+    anyDirty.store(true, std::memory_order_release);
+}
+
+int NavGraph::repair(const Map& map) {
+    if (!anyDirty.exchange(false, std::memory_order_acq_rel)) return 0;
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    size_t chunkCount = chunkSpans.size();
+    relinkScratch.assign(chunkCount, 0);
+    ++revision;
+
+    int repaired = 0;
+    for (size_t c = 0; c < chunkCount; ++c) {
+        if (!dirtyChunks[c].exchange(0, std::memory_order_relaxed)) continue;
+        rebuildChunkSpans(map, static_cast<int>(c));
+        ++repaired;
+
+        int cx = static_cast<int>(c) / chunksHigh;
+        int cy = static_cast<int>(c) % chunksHigh;
+        for (int nx = std::max(0, cx - 1); nx <= std::min(chunksWide - 1, cx + 1); ++nx) {
+            for (int ny = std::max(0, cy - 1); ny <= std::min(chunksHigh - 1, cy + 1); ++ny) {
+                relinkScratch[nx * chunksHigh + ny] = 1;
+            }
+        }
+    }
+
+    for (size_t c = 0; c < chunkCount; ++c) {
+        if (!relinkScratch[c]) continue;
+        chunkRevision[c].store(revision, std::memory_order_release);
+        for (int32_t index : chunkSpans[c]) {
+            rebuildLinks(map, index);
+        }
+    }
+    return repaired;
+}
+
+void NavGraph::rebuildChunkSpans(const Map& map, int chunk) {
+    for (int32_t index : chunkSpans[chunk]) {
+        Span& span = spans[index];
+        for (int x = span.x0; x <= span.x1; ++x) {
+            spanAt[static_cast<size_t>(x) * height + span.y] = -1;
+        }
+        span.alive = false;
+        span.edges.clear();
+        freeSpans.push_back(index);
+        --liveSpans;
+    }
+    chunkSpans[chunk].clear();
+
+    int x0 = (chunk / chunksHigh) * CHUNK_SIZE;
+    int y0 = (chunk % chunksHigh) * CHUNK_SIZE;
+    int x1 = std::min(x0 + CHUNK_SIZE, width);
+    int y1 = std::min(y0 + CHUNK_SIZE, height);
+
+    for (int y = y0; y < y1; ++y) {
+        int runStart = -1;
+        for (int x = x0; x <= x1; ++x) {
+            bool standable = x < x1 && IsStandable(map, x, y);
+            if (standable && runStart < 0) runStart = x;
+            if (standable || runStart < 0) continue;
+
+            int32_t index;
+            if (freeSpans.empty()) {
+                index = static_cast<int32_t>(spans.size());
+                spans.emplace_back();
+            } else {
+                index = freeSpans.back();
+                freeSpans.pop_back();
+            }
+            Span& span = spans[index];
+            span.x0 = static_cast<int16_t>(runStart);
+            span.x1 = static_cast<int16_t>(x - 1);
+            span.y = static_cast<int16_t>(y);
+            span.chunk = chunk;
+            span.alive = true;
+            for (int sx = runStart; sx < x; ++sx) {
+                spanAt[static_cast<size_t>(sx) * height + y] = index;
+            }
+            chunkSpans[chunk].push_back(index);
+            ++liveSpans;
+            runStart = -1;
+        }
+    }
+}
+
+void NavGraph::addEdge(Span& from, int32_t to, float cost, NavLink link, int exitX, int landX) {
+    for (auto& edge : from.edges) {
+        if (edge.to != to) continue;
+        if (cost < edge.cost) {
+            edge = { to, cost, link, static_cast<int16_t>(exitX), static_cast<int16_t>(landX) };
+        }
+        return;
+    }
+    from.edges.push_back({ to, cost, link, static_cast<int16_t>(exitX), static_cast<int16_t>(landX) });
+}
+
+void NavGraph::rebuildLinks(const Map& map, int32_t index) {
+    Span& span = spans[index];
+    span.edges.clear();
+
+    // Spans are cut at chunk borders; the piece across the border is a walk.
+    int32_t right = spanAtCell(span.x1 + 1, span.y);
+    if (right >= 0) addEdge(span, right, 1.0f, NavLink::WALK, span.x1, span.x1 + 1);
+    int32_t left = spanAtCell(span.x0 - 1, span.y);
+    if (left >= 0) addEdge(span, left, 1.0f, NavLink::WALK, span.x0, span.x0 - 1);
+
+    if (right < 0) linkDrop(map, index, span.x1 + 1);
+    if (left < 0) linkDrop(map, index, span.x0 - 1);
+    linkJumps(map, index);
+    linkClimbs(map, index);
+}
+
+void NavGraph::linkDrop(const Map& map, int32_t index, int x) {
+    Span& span = spans[index];
+    if (!IsPassable(map, x, span.y)) return;
+
+    for (int y = span.y + 1; y <= span.y + MAX_DROP && IsPassable(map, x, y); ++y) {
+        int32_t target = spanAtCell(x, y);
+        if (target >= 0) {
+            int exitX = x > span.x1 ? span.x1 : span.x0;
+            addEdge(span, target, 1.0f + (y - span.y), NavLink::DROP, exitX, x);
+            return;
+        }
+    }
+}
+
+void NavGraph::linkJumps(const Map& map, int32_t index) {
+    Span& span = spans[index];
+    int y = span.y;
+
+    for (int ry = y - MAX_JUMP_UP; ry <= y + MAX_JUMP_DOWN; ++ry) {
+        int32_t previous = -1;
+        for (int x = span.x0 - MAX_JUMP_ACROSS; x <= span.x1 + MAX_JUMP_ACROSS; ++x) {
+            int32_t target = spanAtCell(x, ry);
+            if (target < 0 || target == index || target == previous) continue;
+            previous = target;
+
+            const Span& other = spans[target];
+            if (ry == y && (other.x0 == span.x1 + 1 || other.x1 == span.x0 - 1)) continue;
+
+            int takeoffs[6] = { span.x0, span.x1, other.x0 - 1, other.x1 + 1, other.x0, other.x1 };
+            float bestCost = -1.0f;
+            int bestExit = 0;
+            int bestLand = 0;
+            for (int t : takeoffs) {
+                t = std::clamp(t, static_cast<int>(span.x0), static_cast<int>(span.x1));
+                int landings[3] = { std::clamp(t, static_cast<int>(other.x0), static_cast<int>(other.x1)), other.x0, other.x1 };
+                for (int l : landings) {
+                    int across = std::abs(l - t);
+                    if (across > MAX_JUMP_ACROSS) continue;
+                    float cost = JUMP_COST + across + std::abs(ry - y);
+                    if (bestCost >= 0.0f && cost >= bestCost) continue;
+                    if (!IsArcClear(map, t, y, l, ry)) continue;
+                    bestCost = cost;
+                    bestExit = t;
+                    bestLand = l;
+                }
+            }
+            if (bestCost >= 0.0f) {
+                addEdge(span, target, bestCost, NavLink::JUMP, bestExit, bestLand);
+            }
+        }
+    }
+}
+
+void NavGraph::linkClimbs(const Map& map, int32_t index) {
+    Span& span = spans[index];
+    int y = span.y;
+
+    for (int x = span.x0 - 1; x <= span.x1 + 1; ++x) {
+        int entry;
+        if (IsClimbable(map, x, y)) {
+            entry = y;
+        } else if (IsClimbable(map, x, y + 1)) {
+            entry = y + 1;
+        } else {
+            continue;
+        }
+
+        int top = entry;
+        while (top - 1 >= std::max(0, y - MAX_CLIMB) && IsClimbable(map, x, top - 1)) --top;
+        int bottom = entry;
+        while (bottom + 1 < std::min(height, y + MAX_CLIMB) && IsClimbable(map, x, bottom + 1)) ++bottom;
+
+        // The landing rows past either end are capped too: a target more
+        // than MAX_CLIMB rows away could sit two chunks off, outside what
+        // repair() relinks.
+        int exitX = std::clamp(x, static_cast<int>(span.x0), static_cast<int>(span.x1));
+        int firstRow = std::max(top - 1, y - MAX_CLIMB);
+        int lastRow = std::min(bottom + 1, y + MAX_CLIMB);
+        for (int ry = firstRow; ry <= lastRow; ++ry) {
+            for (int rx = x - 1; rx <= x + 1; ++rx) {
+                int32_t target = spanAtCell(rx, ry);
+                if (target < 0 || target == index) continue;
+                float cost = CLIMB_COST + std::abs(ry - y) + std::abs(rx - exitX);
+                addEdge(span, target, cost, NavLink::CLIMB, exitX, rx);
+            }
+        }
+    }
+}
+
+int NavGraph::chunkAt(Vector2 position) const {
+    int x = std::clamp((int)((position.x + 16) / 32), 0, width - 1);
+    int y = std::clamp((int)((position.y + 16) / 32), 0, height - 1);
+    return chunkOf(x, y);
+}
+
+int32_t NavGraph::spanUnder(Vector2 position, int* cellX, int* cellY) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (spans.empty()) return -1;
+    int32_t span = locate(position);
+    if (span < 0) return -1;
+    if (cellX) *cellX = std::clamp((int)((position.x + 16) / 32), static_cast<int>(spans[span].x0), static_cast<int>(spans[span].x1));
+    if (cellY) *cellY = spans[span].y;
+    return span;
+}
+
+bool NavGraph::isChunkUnchangedSince(int chunk, uint64_t since) const {
+    return chunkRevision[chunk].load(std::memory_order_acquire) <= since;
+}
+
+int32_t NavGraph::locate(Vector2 position) const {
+    int x = (int)((position.x + 16) / 32);
+    int y = (int)((position.y + 16) / 32);
+    // Body cell first, then a few rows down for something mid-fall.
+    for (int ry = y - 1; ry <= y + 3; ++ry) {
+        int32_t span = spanAtCell(x, ry);
+        if (span >= 0) return span;
+    }
+    return -1;
+}
+
+bool NavGraph::findPath(Vector2 start, Vector2 goal, std::vector<NavWaypoint>& outPath, int* expansions, uint64_t* searchedRevision) const {
+    outPath.clear();
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (spans.empty()) return false;
+    if (searchedRevision) *searchedRevision = revision;
+
+    int32_t startSpan = locate(start);
+    int32_t goalSpan = locate(goal);
+    if (startSpan < 0 || goalSpan < 0) return false;
+
+    int gx = std::clamp((int)((goal.x + 16) / 32), static_cast<int>(spans[goalSpan].x0), static_cast<int>(spans[goalSpan].x1));
+    int gy = spans[goalSpan].y;
+    int sx = std::clamp((int)((start.x + 16) / 32), static_cast<int>(spans[startSpan].x0), static_cast<int>(spans[startSpan].x1));
+
+    SpanSearchScratch& s = spanScratch;
+    const int32_t goalId = static_cast<int32_t>(spans.size());
+    s.begin(spans.size() + 1);
+
+    auto heuristic = [gx, gy](int x, int y) { return fabsf((float)x - gx) + fabsf((float)y - gy); };
+    auto relax = [&](int32_t node, float g, int32_t from, int32_t edge, int entry, float h) {
+        if (s.stamp[node] == s.generation && g >= s.gScore[node]) return;
+        s.stamp[node] = s.generation;
+        s.gScore[node] = g;
+        s.parent[node] = from;
+        s.parentEdge[node] = edge;
+        s.entryX[node] = static_cast<int16_t>(entry);
+        s.open.push_back({ g + h, g, node });
+        std::push_heap(s.open.begin(), s.open.end(), OpenEntryGreater());
+    };
+
+    relax(startSpan, 0.0f, -1, -1, sx, heuristic(sx, spans[startSpan].y));
+
+    int expanded = 0;
+    bool found = false;
+    while (!s.open.empty()) {
+        std::pop_heap(s.open.begin(), s.open.end(), OpenEntryGreater());
+        OpenEntry current = s.open.back();
+        s.open.pop_back();
+        if (current.g > s.gScore[current.index]) continue;
+        if (current.index == goalId) {
+            found = true;
+            break;
+        }
+        ++expanded;
+
+        const Span& span = spans[current.index];
+        int entry = s.entryX[current.index];
+        if (current.index == goalSpan) {
+            relax(goalId, current.g + std::abs(gx - entry), current.index, -1, gx, 0.0f);
+        }
+        for (int32_t e = 0; e < static_cast<int32_t>(span.edges.size()); ++e) {
+            const Edge& edge = span.edges[e];
+            float g = current.g + std::abs(edge.exitX - entry) + edge.cost;
+            relax(edge.to, g, current.index, e, edge.landX, heuristic(edge.landX, spans[edge.to].y));
+        }
+    }
+    if (expansions) *expansions = expanded;
+    if (!found) return false;
+
+    s.route.clear();
+    for (int32_t n = s.parent[goalId]; n != startSpan; n = s.parent[n]) {
+        s.route.push_back(n);
+    }
+    std::reverse(s.route.begin(), s.route.end());
+
+    auto push = [&outPath](int x, int y, NavLink link) {
+        Vector2 position = { x * 32.0f, y * 32.0f };
+        if (!outPath.empty() && outPath.back().position.x == position.x && outPath.back().position.y == position.y) return;
+        outPath.push_back({ position, link });
+    };
+
+    int32_t from = startSpan;
+    for (int32_t node : s.route) {
+        const Edge& edge = spans[from].edges[s.parentEdge[node]];
+        push(edge.exitX, spans[from].y, NavLink::WALK);
+        push(edge.landX, spans[node].y, edge.link);
+        from = node;
+    }
+    push(gx, gy, NavLink::WALK);
+    return true;
+}
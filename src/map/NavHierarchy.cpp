@@ -0,0 +1,325 @@
+#include "map/NavHierarchy.hpp"
+#include "map/Map.hpp"
+#include "map/TileMask.hpp"
+#include "core/Parallel.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr int MAX_SINGLE_ENTRANCE_RUN = 6;
+
+    bool IsWalkable(const Map& map, int x, int y) {
+        return map.isTileEmpty(x, y) && map.isSolidTile(x, y + 1);
+    }
+
+    // Breadth-first search confined to one cluster. The seed cell need not
+    // be walkable, matching FindPathAStar's start cell. walkable(x, y) reads
+    // the map at build time and the TileMask at query time.
+    struct ClusterSearch {
+        int originX = 0;
+        int originY = 0;
+        int w = 0;
+        int h = 0;
+        uint32_t generation = 0;
+        uint32_t stamp[NavHierarchy::CLUSTER_SIZE * NavHierarchy::CLUSTER_SIZE] = {};
+        uint16_t distance[NavHierarchy::CLUSTER_SIZE * NavHierarchy::CLUSTER_SIZE];
+        int16_t parent[NavHierarchy::CLUSTER_SIZE * NavHierarchy::CLUSTER_SIZE];
+        int16_t queue[NavHierarchy::CLUSTER_SIZE * NavHierarchy::CLUSTER_SIZE];
+
+        template <typename Walkable>
+        int run(const Walkable& walkable, int seedX, int seedY, int ox, int oy, int cw, int ch) {
+            originX = ox;
+            originY = oy;
+            w = cw;
+            h = ch;
+            if (++generation == 0) {
+                std::fill(std::begin(stamp), std::end(stamp), 0);
+                generation = 1;
+            }
+
+            const int dirs[4][2] = { {1,0}, {-1,0}, {0,1}, {0,-1} };
+            int head = 0;
+            int tail = 0;
+            int16_t seed = static_cast<int16_t>((seedX - ox) * h + (seedY - oy));
+            stamp[seed] = generation;
+            distance[seed] = 0;
+            parent[seed] = -1;
+            queue[tail++] = seed;
+
+            while (head < tail) {
+                int16_t current = queue[head++];
+                int lx = current / h;
+                int ly = current % h;
+                for (const auto& d : dirs) {
+                    int nlx = lx + d[0];
+                    int nly = ly + d[1];
+                    if (nlx < 0 || nly < 0 || nlx >= w || nly >= h) continue;
+                    int16_t neighbor = static_cast<int16_t>(nlx * h + nly);
+                    if (stamp[neighbor] == generation) continue;
+                    if (!walkable(ox + nlx, oy + nly)) continue;
+                    stamp[neighbor] = generation;
+                    distance[neighbor] = distance[current] + 1;
+                    parent[neighbor] = current;
+                    queue[tail++] = neighbor;
+                }
+            }
+            return tail;
+        }
+
+        int distanceTo(int x, int y) const {
+            int i = (x - originX) * h + (y - originY);
+            return stamp[i] == generation ? distance[i] : -1;
+        }
+
+        // Appends the cells after the seed up to and including (x, y).
+        void appendRoute(int x, int y, std::vector<Vector2>& out) const {
+            size_t first = out.size();
+            for (int i = (x - originX) * h + (y - originY); parent[i] != -1; i = parent[i]) {
+                out.push_back(Vector2{ (originX + i / h) * 32.0f, (originY + i % h) * 32.0f });
+            }
+            std::reverse(out.begin() + first, out.end());
+        }
+    };
+
+    struct OpenEntry {
+        float f;
+        float g;
+        int32_t index;
+    };
+
+    struct OpenEntryGreater {
+        bool operator()(const OpenEntry& a, const OpenEntry& b) const {
+            if (a.f != b.f) return a.f > b.f;
+            return a.g < b.g;
+        }
+    };
+
+    struct AbstractScratch {
+        uint32_t generation = 0;
+        std::vector<uint32_t> stamp;
+        std::vector<float> gScore;
+        std::vector<int32_t> parent;
+        std::vector<OpenEntry> open;
+        std::vector<int32_t> route;
+
+        void begin(size_t count) {
+            if (stamp.size() != count) {
+                stamp.assign(count, 0);
+                gScore.resize(count);
+                parent.resize(count);
+                generation = 0;
+            }
+            if (++generation == 0) {
+                std::fill(stamp.begin(), stamp.end(), 0);
+                generation = 1;
+            }
+            open.clear();
+        }
+    };
+
+    thread_local ClusterSearch startSearch;
+    thread_local ClusterSearch goalSearch;
+    thread_local AbstractScratch abstractScratch;
+}
+
+int32_t NavHierarchy::nodeAt(int x, int y, std::vector<std::vector<Edge>>& adjacency) {
+    int32_t& slot = nodeIndex[static_cast<size_t>(x) * height + y];
+    if (slot < 0) {
+        slot = static_cast<int32_t>(nodes.size());
+        nodes.push_back({ x, y, clusterOf(x, y), 0, 0 });
+        adjacency.emplace_back();
+        clusterNodes[clusterOf(x, y)].push_back(slot);
+    }
+    return slot;
+}
+
+void NavHierarchy::addTransition(int ax, int ay, int bx, int by, std::vector<std::vector<Edge>>& adjacency) {
+    int32_t a = nodeAt(ax, ay, adjacency);
+    int32_t b = nodeAt(bx, by, adjacency);
+    adjacency[a].push_back({ b, 1.0f });
+    adjacency[b].push_back({ a, 1.0f });
+}
+
+void NavHierarchy::build(const Map& map) {
+    width = map.getWidth();
+    height = map.getHeight();
+    clustersWide = (width + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    clustersHigh = (height + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+
+    nodes.clear();
+    edges.clear();
+    clusterNodes.assign(static_cast<size_t>(clustersWide) * clustersHigh, {});
+    nodeIndex.assign(static_cast<size_t>(width) * height, -1);
+    std::vector<std::vector<Edge>> adjacency;
+
+    // One transition per short run of open border, two (at the ends) for a
+    // long one, so wide openings still offer a choice of crossing point.
+    auto addRun = [&](int runStart, int runLength, bool vertical, int border) {
+        auto place = [&](int along) {
+            if (vertical) {
+                addTransition(border, along, border + 1, along, adjacency);
+            } else {
+                addTransition(along, border, along, border + 1, adjacency);
+            }
+        };
+        if (runLength <= MAX_SINGLE_ENTRANCE_RUN) {
+            place(runStart + runLength / 2);
+        } else {
+            place(runStart);
+            place(runStart + runLength - 1);
+        }
+    };
+
+    for (int cx = 0; cx + 1 < clustersWide; ++cx) {
+        int x = (cx + 1) * CLUSTER_SIZE - 1;
+        for (int cy = 0; cy < clustersHigh; ++cy) {
+            int yEnd = std::min((cy + 1) * CLUSTER_SIZE, height);
+            int runStart = -1;
+            for (int y = cy * CLUSTER_SIZE; y <= yEnd; ++y) {
+                bool open = y < yEnd && IsWalkable(map, x, y) && IsWalkable(map, x + 1, y);
+                if (open && runStart < 0) runStart = y;
+                if (!open && runStart >= 0) {
+                    addRun(runStart, y - runStart, true, x);
+                    runStart = -1;
+                }
+            }
+        }
+    }
+
+    for (int cy = 0; cy + 1 < clustersHigh; ++cy) {
+        int y = (cy + 1) * CLUSTER_SIZE - 1;
+        for (int cx = 0; cx < clustersWide; ++cx) {
+            int xEnd = std::min((cx + 1) * CLUSTER_SIZE, width);
+            int runStart = -1;
+            for (int x = cx * CLUSTER_SIZE; x <= xEnd; ++x) {
+                bool open = x < xEnd && IsWalkable(map, x, y) && IsWalkable(map, x, y + 1);
+                if (open && runStart < 0) runStart = x;
+                if (!open && runStart >= 0) {
+                    addRun(runStart, x - runStart, false, y);
+                    runStart = -1;
+                }
+            }
+        }
+    }
+
+    // Each cluster only appends to its own nodes' edge lists.
+    auto walkable = [&map](int x, int y) { return IsWalkable(map, x, y); };
+    parallel_for(0, clusterNodes.size(), [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            const auto& members = clusterNodes[c];
+            if (members.size() < 2) continue;
+
+            int ox = static_cast<int>(c / clustersHigh) * CLUSTER_SIZE;
+            int oy = static_cast<int>(c % clustersHigh) * CLUSTER_SIZE;
+            int cw = std::min(CLUSTER_SIZE, width - ox);
+            int ch = std::min(CLUSTER_SIZE, height - oy);
+
+            for (int32_t from : members) {
+                startSearch.run(walkable, nodes[from].x, nodes[from].y, ox, oy, cw, ch);
+                for (int32_t to : members) {
+                    if (to == from) continue;
+                    int d = startSearch.distanceTo(nodes[to].x, nodes[to].y);
+                    if (d > 0) adjacency[from].push_back({ to, static_cast<float>(d) });
+                }
+            }
+        }
+    });
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i].firstEdge = static_cast<int32_t>(edges.size());
+        nodes[i].edgeCount = static_cast<int32_t>(adjacency[i].size());
+        edges.insert(edges.end(), adjacency[i].begin(), adjacency[i].end());
+    }
+}
+
+bool NavHierarchy::findPath(const Map& map, Vector2 start, Vector2 goal, std::vector<Vector2>& outPath, int* expansions) const {
+    outPath.clear();
+    if (nodes.empty() || map.getWidth() != width || map.getHeight() != height) return false;
+    // Queries run on path workers while the simulation writes tiles, so
+    // they read the atomic mask rather than Map::tiles.
+    const TileMask* mask = map.getTileMask();
+    if (!mask) return false;
+
+    int sx = (int)((start.x + 16) / 32);
+    int sy = (int)((start.y + 32) / 32);
+    int gx = (int)((goal.x + 16) / 32);
+    int gy = (int)((goal.y + 32) / 32);
+    if (sx < 0 || sy < 0 || sx >= width || sy >= height) return false;
+    if (gx < 0 || gy < 0 || gx >= width || gy >= height) return false;
+
+    int startCluster = clusterOf(sx, sy);
+    int goalCluster = clusterOf(gx, gy);
+    if (startCluster == goalCluster) return false;
+
+    auto walkable = [mask](int x, int y) { return mask->isWalkable(x, y); };
+    auto clusterRun = [&](ClusterSearch& search, int x, int y) {
+        int ox = (x / CLUSTER_SIZE) * CLUSTER_SIZE;
+        int oy = (y / CLUSTER_SIZE) * CLUSTER_SIZE;
+        return search.run(walkable, x, y, ox, oy, std::min(CLUSTER_SIZE, width - ox), std::min(CLUSTER_SIZE, height - oy));
+    };
+    int expanded = clusterRun(startSearch, sx, sy) + clusterRun(goalSearch, gx, gy);
+
+    AbstractScratch& s = abstractScratch;
+    const int32_t goalId = static_cast<int32_t>(nodes.size());
+    s.begin(nodes.size() + 1);
+
+    auto heuristic = [gx, gy](int x, int y) { return fabsf((float)x - gx) + fabsf((float)y - gy); };
+    auto relax = [&](int32_t index, float g, int32_t from, float h) {
+        if (s.stamp[index] == s.generation && g >= s.gScore[index]) return;
+        s.stamp[index] = s.generation;
+        s.gScore[index] = g;
+        s.parent[index] = from;
+        s.open.push_back({ g + h, g, index });
+        std::push_heap(s.open.begin(), s.open.end(), OpenEntryGreater());
+    };
+
+    for (int32_t n : clusterNodes[startCluster]) {
+        int d = startSearch.distanceTo(nodes[n].x, nodes[n].y);
+        if (d >= 0) relax(n, static_cast<float>(d), -1, heuristic(nodes[n].x, nodes[n].y));
+    }
+
+    bool found = false;
+    while (!s.open.empty()) {
+        std::pop_heap(s.open.begin(), s.open.end(), OpenEntryGreater());
+        OpenEntry current = s.open.back();
+        s.open.pop_back();
+        if (current.g > s.gScore[current.index]) continue;
+        if (current.index == goalId) {
+            found = true;
+            break;
+        }
+        ++expanded;
+
+        const Node& node = nodes[current.index];
+        if (node.cluster == goalCluster) {
+            int d = goalSearch.distanceTo(node.x, node.y);
+            if (d >= 0) relax(goalId, current.g + d, current.index, 0.0f);
+        }
+        for (int32_t e = node.firstEdge; e < node.firstEdge + node.edgeCount; ++e) {
+            const Node& next = nodes[edges[e].to];
+            relax(edges[e].to, current.g + edges[e].cost, current.index, heuristic(next.x, next.y));
+        }
+    }
+    if (expansions) *expansions = expanded;
+    if (!found) return false;
+
+    s.route.clear();
+    for (int32_t n = s.parent[goalId]; n != -1; n = s.parent[n]) {
+        s.route.push_back(n);
+    }
+    std::reverse(s.route.begin(), s.route.end());
+
+    // Only the first leg is refined; the rest stays coarse until the caller
+    // asks again from further along.
+    const Node& first = nodes[s.route.front()];
+    startSearch.appendRoute(first.x, first.y, outPath);
+    for (size_t i = 1; i < s.route.size(); ++i) {
+        const Node& node = nodes[s.route[i]];
+        outPath.push_back(Vector2{ node.x * 32.0f, node.y * 32.0f });
+    }
+    const Node& last = nodes[s.route.back()];
+    if (last.x != gx || last.y != gy) {
+        outPath.push_back(Vector2{ gx * 32.0f, gy * 32.0f });
+    }
+    return true;
+}
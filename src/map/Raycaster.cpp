@@ -0,0 +1,85 @@
+#include "map/Raycaster.hpp"
+#include "map/TileMask.hpp"
+#include "core/Parallel.hpp"
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr size_t BATCH_GRAIN = 64;
+}
+
+Raycaster::Raycaster(const TileMask& mask) : mask(mask) {}
+
+bool Raycaster::isBlocked(int x, int y, RayBlocker blocker) const {
+    return blocker == RayBlocker::OPAQUE ? mask.isOpaque(x, y) : mask.isSolid(x, y);
+}
+
+bool Raycaster::raycast(Vector2 from, Vector2 to, RayHit& hit, RayBlocker blocker) const {
+    hit = RayHit{};
+    int x = static_cast<int>(std::floor(from.x / TILE_SIZE));
+    int y = static_cast<int>(std::floor(from.y / TILE_SIZE));
+    if (isBlocked(x, y, blocker)) {
+        hit.hit = true;
+        hit.point = from;
+        hit.tileX = x;
+        hit.tileY = y;
+        return true;
+    }
+
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f) return false;
+    dx /= length;
+    dy /= length;
+
+    // tMax: distance along the ray to the next vertical / horizontal tile
+    // edge; tDelta: distance between successive edges on that axis.
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    int stepX = dx > 0.0f ? 1 : (dx < 0.0f ? -1 : 0);
+    int stepY = dy > 0.0f ? 1 : (dy < 0.0f ? -1 : 0);
+    float tMaxX = stepX > 0 ? ((x + 1) * TILE_SIZE - from.x) / dx : (stepX < 0 ? (x * TILE_SIZE - from.x) / dx : INF);
+    float tMaxY = stepY > 0 ? ((y + 1) * TILE_SIZE - from.y) / dy : (stepY < 0 ? (y * TILE_SIZE - from.y) / dy : INF);
+    float tDeltaX = stepX != 0 ? TILE_SIZE / std::fabs(dx) : INF;
+    float tDeltaY = stepY != 0 ? TILE_SIZE / std::fabs(dy) : INF;
+
+    for (;;) {
+        float t;
+        Vector2 normal;
+        if (tMaxX < tMaxY) {
+            t = tMaxX;
+            x += stepX;
+            tMaxX += tDeltaX;
+            normal = { static_cast<float>(-stepX), 0.0f };
+        } else {
+            t = tMaxY;
+            y += stepY;
+            tMaxY += tDeltaY;
+            normal = { 0.0f, static_cast<float>(-stepY) };
+        }
+        if (t > length) return false;
+
+        if (isBlocked(x, y, blocker)) {
+            hit.hit = true;
+            hit.point = { from.x + dx * t, from.y + dy * t };
+            hit.distance = t;
+            hit.normal = normal;
+            hit.tileX = x;
+            hit.tileY = y;
+            return true;
+        }
+    }
+}
+
+void Raycaster::raycastBatch(const RaySegment* segments, size_t count, RayHit* hits, RayBlocker blocker) const {
+    auto castRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            raycast(segments[i].from, segments[i].to, hits[i], blocker);
+        }
+    };
+    if (count <= BATCH_GRAIN) {
+        castRange(0, count);
+        return;
+    }
+    parallel_for(0, count, BATCH_GRAIN, castRange);
+}
@@ -1,5 +1,5 @@
 #include "map/RoomConnectionGenerator.hpp"
-#include "core/GlobalThreadPool.hpp"
+#include "core/JobSystem.hpp"
 #include <set>
 #include <algorithm>
 #include <climits>
@@ -248,7 +248,7 @@ void RoomConnectionGenerator::executeCorridorTasks(Map& map, const std::vector<C
         size_t endIdx = std::min(startIdx + chunkSize, tasks.size());
         
         if (startIdx < endIdx) {
-            futures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue(
+            futures.push_back(JobSystem::getInstance().submit(JobPriority::FRAME_CRITICAL, 
                 [&map, &tasks, &thread_ladders, &thread_ropes, &total_tiles_processed, &total_ladders, &total_ropes, 
                  startIdx, endIdx, t, map_width, map_height]() {
                     size_t local_tiles = 0;
@@ -3,12 +3,9 @@
 #include "map/RoomGridGenerator.hpp"
 #include "map/RoomConnectionGenerator.hpp"
 #include "map/LadderRopePlacer.hpp"
-#include "core/GlobalThreadPool.hpp"
+#include "core/Parallel.hpp"
 #include <cstdio>
-#include <future>
-#include <thread>
 #include <algorithm>
-#include <atomic>
 #include <chrono>
 
 using namespace MapConstants;
@@ -42,31 +39,14 @@ void RoomGenerator::generateRoomsAndConnections(Map& map, std::mt19937& gen, std
         if (progressCallback) progressCallback(0.75f);
         
         printf("[Map] Filling tiles with default values...\n");
-        size_t numThreads = std::thread::hardware_concurrency();
-        if (numThreads == 0) numThreads = 2;
-        
-        size_t chunkSizeX = (map.getWidth() - 2 + numThreads - 1) / numThreads;
-        std::vector<std::future<void>> tileFillFutures;
-        
-        for (size_t t = 0; t < numThreads; ++t) {
-            size_t startX = 1 + t * chunkSizeX;
-            size_t endX = std::min(startX + chunkSizeX, (size_t)(map.getWidth() - 1));
-            
-            if (startX < endX) {
-                tileFillFutures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue([&map, startX, endX]() {
-                    for (size_t x_coord = startX; x_coord < endX; ++x_coord) {
-                        for (int y_coord = 1; y_coord < map.getHeight() - 1; ++y_coord) {
-                            map.tiles[x_coord][y_coord] = DEFAULT_TILE_VALUE;
-                            map.isOriginalSolid[x_coord][y_coord] = true;
-                        }
-                    }
-                }));
+        parallel_for(1, map.getWidth() - 1, [&map](size_t xBegin, size_t xEnd) {
+            for (size_t x_coord = xBegin; x_coord < xEnd; ++x_coord) {
+                for (int y_coord = 1; y_coord < map.getHeight() - 1; ++y_coord) {
+                    map.tiles[x_coord][y_coord] = DEFAULT_TILE_VALUE;
+                    map.isOriginalSolid[x_coord][y_coord] = true;
+                }
             }
-        }
-        
-        for (auto& future : tileFillFutures) {
-            future.get();
-        }
+        });
         
         auto after_tile_fill = std::chrono::high_resolution_clock::now();
         auto tile_fill_time = std::chrono::duration_cast<std::chrono::milliseconds>(after_tile_fill - after_room_grid).count();
@@ -119,52 +99,27 @@ void RoomGenerator::generateRoomsAndConnections(Map& map, std::mt19937& gen, std
         throw; 
     }
 
-    size_t numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 2;
-    
-    std::atomic<int> chestCount{0};
-    size_t chunkSizeX = (map.getWidth() + numThreads - 1) / numThreads;
-    std::vector<std::future<void>> chestCountFutures;
-    
-    for (size_t t = 0; t < numThreads; ++t) {
-        size_t startX = t * chunkSizeX;
-        size_t endX = std::min(startX + chunkSizeX, (size_t)map.getWidth());
-        
-        if (startX < endX) {
-            chestCountFutures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue(
-                [&map, &chestCount, startX, endX]() {
-                    int localCount = 0;
-                    for (size_t x = startX; x < endX; ++x) {
-                        for (int y = 0; y < map.getHeight(); ++y) {
-                            if (map.tiles[x][y] == CHEST_TILE_VALUE) {
-                                localCount++;
-                            }
-                        }
+    int chestCount = parallel_reduce(0, map.getWidth(), 0, 0,
+        [&map](size_t xBegin, size_t xEnd) {
+            int localCount = 0;
+            for (size_t x = xBegin; x < xEnd; ++x) {
+                for (int y = 0; y < map.getHeight(); ++y) {
+                    if (map.tiles[x][y] == CHEST_TILE_VALUE) {
+                        localCount++;
                     }
-                    chestCount += localCount;
-                }));
-        }
-    }
-
-    for (auto& future : chestCountFutures) {
-        future.get();
-    }
-    
+                }
+            }
+            return localCount;
+        },
+        [](int a, int b) { return a + b; });
+    printf("[Map] Placed %d chests\n", chestCount);
 }
 
 void RoomGenerator::generateAllRoomContent(Map& map, const std::vector<Room>& rooms_vector, std::mt19937& gen) {
 
-    size_t numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 2;
-
-    numThreads = std::min(numThreads, rooms_vector.size());
-    
-    if (numThreads <= 1 || rooms_vector.size() <= 1) {
-
-        int treasureRoomCount = 0;
+    if (rooms_vector.size() <= 1) {
         for (const auto& room : rooms_vector) {
             if (room.type == Room::TREASURE) {
-                treasureRoomCount++;
                 RoomContentGenerator::generateTreasureRoomContent(map, room, gen);
             } else if (room.type == Room::SHOP) {
                 RoomContentGenerator::generateShopRoomContent(map, room, gen);
@@ -175,40 +130,26 @@ void RoomGenerator::generateAllRoomContent(Map& map, const std::vector<Room>& ro
         return;
     }
 
-    std::vector<std::mt19937> threadGens;
-    std::random_device rd;
-    for (size_t i = 0; i < numThreads; ++i) {
-        threadGens.emplace_back(rd());
-    }
-    
-    size_t roomsPerThread = (rooms_vector.size() + numThreads - 1) / numThreads;
-    std::vector<std::future<void>> roomContentFutures;
-    
-    for (size_t t = 0; t < numThreads; ++t) {
-        size_t startIdx = t * roomsPerThread;
-        size_t endIdx = std::min(startIdx + roomsPerThread, rooms_vector.size());
-        
-        if (startIdx < endIdx) {
-            roomContentFutures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue(
-                [&map, &rooms_vector, &threadGens, t, startIdx, endIdx]() {
-                    auto& threadGen = threadGens[t];
-                    for (size_t i = startIdx; i < endIdx; ++i) {
-                        const auto& room = rooms_vector[i];
-                        if (room.type == Room::TREASURE) {
-                            RoomContentGenerator::generateTreasureRoomContent(map, room, threadGen);
-                        } else if (room.type == Room::SHOP) {
-                            RoomContentGenerator::generateShopRoomContent(map, room, threadGen);
-                        } else {
-                            RoomContentGenerator::generateRoomContent(map, room, threadGen);
-                        }
-                    }
-                }));
-        }
+    // One seed per room, drawn up front, so the result does not depend on
+    // which thread picks up which room.
+    std::vector<std::mt19937::result_type> roomSeeds(rooms_vector.size());
+    for (auto& seed : roomSeeds) {
+        seed = gen();
     }
 
-    for (auto& future : roomContentFutures) {
-        future.get();
-    }
+    parallel_for(0, rooms_vector.size(), 1, [&map, &rooms_vector, &roomSeeds](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            std::mt19937 roomGen(roomSeeds[i]);
+            const auto& room = rooms_vector[i];
+            if (room.type == Room::TREASURE) {
+                RoomContentGenerator::generateTreasureRoomContent(map, room, roomGen);
+            } else if (room.type == Room::SHOP) {
+                RoomContentGenerator::generateShopRoomContent(map, room, roomGen);
+            } else {
+                RoomContentGenerator::generateRoomContent(map, room, roomGen);
+            }
+        }
+    });
 }
 
 void RoomGenerator::protectEmptyTilesNearWalls(Map& map) {
@@ -229,48 +170,28 @@ void RoomGenerator::protectEmptyTilesNearWalls(Map& map) {
     
     printf("[Map] Found %zu wall tiles to process\n", wallPositions.size());
     
-    size_t numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 2;
-
-    size_t chunkSize = (wallPositions.size() + numThreads - 1) / numThreads;
-    std::vector<std::future<void>> wallProtectionFutures;
-    
-    for (size_t t = 0; t < numThreads; ++t) {
-        size_t startIdx = t * chunkSize;
-        size_t endIdx = std::min(startIdx + chunkSize, wallPositions.size());
+    parallel_for(0, wallPositions.size(), [&map, &wallPositions](size_t begin, size_t end) {
+        constexpr int PROTECTION_RADIUS = 2; 
         
-        if (startIdx < endIdx) {
-            wallProtectionFutures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue(
-                [&map, &wallPositions, startIdx, endIdx]() {
-
-                    constexpr int PROTECTION_RADIUS = 2; 
-                    
-                    for (size_t i = startIdx; i < endIdx; ++i) {
-                        const auto& [wallX, wallY] = wallPositions[i];
+        for (size_t i = begin; i < end; ++i) {
+            const auto& [wallX, wallY] = wallPositions[i];
 
-                        for (int dx = -PROTECTION_RADIUS; dx <= PROTECTION_RADIUS; ++dx) {
-                            for (int dy = -PROTECTION_RADIUS; dy <= PROTECTION_RADIUS; ++dy) {
-                                int nx = wallX + dx;
-                                int ny = wallY + dy;
+            for (int dx = -PROTECTION_RADIUS; dx <= PROTECTION_RADIUS; ++dx) {
+                for (int dy = -PROTECTION_RADIUS; dy <= PROTECTION_RADIUS; ++dy) {
+                    int nx = wallX + dx;
+                    int ny = wallY + dy;
 
-                                if (nx <= 0 || nx >= map.getWidth() - 1 || ny <= 0 || ny >= map.getHeight() - 1) {
-                                    continue;
-                                }
+                    if (nx <= 0 || nx >= map.getWidth() - 1 || ny <= 0 || ny >= map.getHeight() - 1) {
+                        continue;
+                    }
 
-                                if (map.tiles[nx][ny] == EMPTY_TILE_VALUE) {
-                                    map.tiles[nx][ny] = PROTECTED_EMPTY_TILE_VALUE;
-                                }
-                            }
-                        }
+                    if (map.tiles[nx][ny] == EMPTY_TILE_VALUE) {
+                        map.tiles[nx][ny] = PROTECTED_EMPTY_TILE_VALUE;
                     }
-                }));
+                }
+            }
         }
-    }
-    
-
-    for (auto& future : wallProtectionFutures) {
-        future.get();
-    }
+    });
     
     printf("[Map] Wall protection optimization complete\n");
 }
@@ -0,0 +1,81 @@
+#include "map/TileMask.hpp"
+#include "map/Map.hpp"
+#include <algorithm>
+
+void TileMask::build(const Map& map) {
+    width = map.getWidth();
+    height = map.getHeight();
+    rowWords = (width + 63) / 64;
+    columnWords = (height + 63) / 64;
+    chunksHigh = (height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunkCount = static_cast<size_t>((width + CHUNK_SIZE - 1) / CHUNK_SIZE) * chunksHigh;
+
+    size_t rowCount = static_cast<size_t>(height) * rowWords;
+    size_t columnCount = static_cast<size_t>(width) * columnWords;
+    rows = std::make_unique<std::atomic<uint64_t>[]>(rowCount);
+    columns = std::make_unique<std::atomic<uint64_t>[]>(columnCount);
+    solidRows = std::make_unique<std::atomic<uint64_t>[]>(rowCount);
+    opaqueRows = std::make_unique<std::atomic<uint64_t>[]>(rowCount);
+    dirtyChunks = std::make_unique<std::atomic<uint8_t>[]>(chunkCount);
+    for (size_t i = 0; i < rowCount; ++i) {
+        rows[i].store(0, std::memory_order_relaxed);
+        solidRows[i].store(0, std::memory_order_relaxed);
+        opaqueRows[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < columnCount; ++i) columns[i].store(0, std::memory_order_relaxed);
+    for (size_t c = 0; c < chunkCount; ++c) dirtyChunks[c].store(0, std::memory_order_relaxed);
+    anyDirty.store(false, std::memory_order_relaxed);
+
+    for (int x = 0; x < width; ++x) {
+        for (int y = 0; y < height; ++y) {
+            refreshCell(map, x, y);
+        }
+    }
+}
+
+void TileMask::markDirty(int x, int y) {
+    if (!dirtyChunks || x < 0 || y < 0 || x >= width || y >= height) return;
+    dirtyChunks[(x / CHUNK_SIZE) * chunksHigh + y / CHUNK_SIZE].store(1, std::memory_order_relaxed);
+    if (y > 0) {
+        dirtyChunks[(x / CHUNK_SIZE) * chunksHigh + (y - 1) / CHUNK_SIZE].store(1, std::memory_order_relaxed);
+    }
+    anyDirty.store(true, std::memory_order_release);
+}
+
+void TileMask::repair(const Map& map) {
+    if (!anyDirty.exchange(false, std::memory_order_acq_rel)) return;
+
+    for (size_t c = 0; c < chunkCount; ++c) {
+        if (!dirtyChunks[c].exchange(0, std::memory_order_relaxed)) continue;
+        int x0 = static_cast<int>(c) / chunksHigh * CHUNK_SIZE;
+        int y0 = static_cast<int>(c) % chunksHigh * CHUNK_SIZE;
+        for (int x = x0; x < std::min(x0 + CHUNK_SIZE, width); ++x) {
+            for (int y = y0; y < std::min(y0 + CHUNK_SIZE, height); ++y) {
+                refreshCell(map, x, y);
+            }
+        }
+    }
+}
+
+namespace {
+    void AssignBit(std::atomic<uint64_t>& word, uint64_t bit, bool value) {
+        if (value) {
+            word.fetch_or(bit, std::memory_order_relaxed);
+        } else {
+            word.fetch_and(~bit, std::memory_order_relaxed);
+        }
+    }
+}
+
+void TileMask::refreshCell(const Map& map, int x, int y) {
+    bool walkable = map.isTileEmpty(x, y) && map.isSolidTile(x, y + 1);
+    bool solid = map.isSolidTile(x, y);
+    bool opaque = solid && map.getTileValue(x, y) != MapConstants::PLATFORM_TILE_VALUE;
+
+    uint64_t rowBit = uint64_t(1) << (x & 63);
+    size_t rowIndex = static_cast<size_t>(y) * rowWords + (x >> 6);
+    AssignBit(rows[rowIndex], rowBit, walkable);
+    AssignBit(columns[static_cast<size_t>(x) * columnWords + (y >> 6)], uint64_t(1) << (y & 63), walkable);
+    AssignBit(solidRows[rowIndex], rowBit, solid);
+    AssignBit(opaqueRows[rowIndex], rowBit, opaque);
+}
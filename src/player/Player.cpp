@@ -1,6 +1,6 @@
 #include "Player.hpp"
 #include "enemies/EnemyManager.hpp"
-#include "core/GlobalThreadPool.hpp"
+#include "core/JobSystem.hpp"
 
 #include <raylib.h>
 #include <raymath.h>
@@ -44,7 +44,7 @@ Player::Player(const Map &map) {
     weapons.push_back(std::make_unique<Bow>());
     currentWeaponIndex = 1;
 
-    imageFuture = GlobalThreadPool::getInstance().getMainPool().enqueue([]() {
+    imageFuture = JobSystem::getInstance().submit(JobPriority::STREAMING, []() {
         return LoadImageAsync("../resources/image.png");
     });
 
@@ -123,11 +123,6 @@ void Player::update(float dt, const Map& map, const Camera2D& gameCamera, EnemyM
                     attack();
                 }
                 bow->updatePosition(position);
-
-                if (bow->hasActiveArrows()) {
-                    int default_substeps = 1;
-                    bow->updateArrowsWithSubsteps(dt, enemyManager, default_substeps, map);
-                }
             }
         } else {
             if (inputManager.isActionPressed(Core::InputAction::ATTACK)) {
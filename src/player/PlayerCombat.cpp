@@ -3,14 +3,11 @@
 #include "weapons/Weapon.hpp"
 #include "weapons/WeaponTypes.hpp"
 #include "enemies/EnemyManager.hpp"
-#include "effects/ParticleSystem.hpp"
-#include "core/GlobalThreadPool.hpp"
+#include "CollisionGrid.hpp"
+#include "CombatResolver.hpp"
 #include <raylib.h>
 #include <vector>
 #include <memory>
-#include <thread>
-#include <future>
-#include <mutex>
 
 
 void Player::attack() {
@@ -58,48 +55,37 @@ void Player::checkWeaponHits(EnemyManager& enemyManager) {
         return;
     }
 
-    auto enemies = enemyManager.getAllEnemies();
-    std::mutex enemyMutex;
-    size_t numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 2;
-
-    size_t enemyChunk = (enemies.size() + numThreads - 1) / numThreads;
-    std::vector<std::future<void>> enemyFutures;
-    for (size_t t = 0; t < numThreads; ++t) {
-        size_t start = t * enemyChunk;
-        size_t end = std::min(start + enemyChunk, enemies.size());
-        if (start >= end) continue;
-        enemyFutures.push_back(GlobalThreadPool::getInstance().getMainPool().enqueue([&, start, end]() {
-            for (size_t i = start; i < end; ++i) {
-                auto* enemy = enemies[i];
-                if (enemy->isAlive()) {
-                    Rectangle enemyHitbox = enemy->getHitbox();
-                    if (enemy->getType() == EnemyType::SCRAP_HOUND) {
-                        ScrapHound* scrapHound = static_cast<ScrapHound*>(enemy);
-                        enemyHitbox = scrapHound->getArrowHitbox();
-                    }
-                    if (CheckCollisionRecs(weaponHitbox, enemyHitbox)) {
-                        if (enemy->canTakeDamage()) {
-                            std::lock_guard<std::mutex> lock(enemyMutex);
-                            enemy->takeDamage(currentWeapon->getDamage());
-                            enemy->applyKnockback(currentWeapon->getKnockback(facingRight));
-                            
-                            Vector2 hitPos = {enemyHitbox.x + enemyHitbox.width/2, enemyHitbox.y + enemyHitbox.height/2};
-                            Color particleColor = RED;
-                            if (enemy->getType() == EnemyType::AUTOMATON) {
-                                particleColor = ORANGE;
-                            } else if (enemy->getType() == EnemyType::DETONODE) {
-                                particleColor = YELLOW;
-                            }
-                            ParticleSystem::getInstance().createExplosionParticles(hitPos, 6, particleColor);
-                        }
-                    }
+    const CollisionGrid& grid = CollisionGrid::getInstance();
+    thread_local std::vector<ColliderId> candidates;
+    candidates.clear();
+    grid.queryRect(weaponHitbox, ColliderMask::ENEMY, candidates);
+    for (ColliderId id : candidates) {
+        EnemyHandle handle = grid.get(id).enemy;
+        Enemy* enemy = enemyManager.getEnemy(handle);
+        if (enemy && enemy->isAlive()) {
+            Rectangle enemyHitbox = enemy->getHitbox();
+            if (enemy->getType() == EnemyType::SCRAP_HOUND) {
+                ScrapHound* scrapHound = static_cast<ScrapHound*>(enemy);
+                enemyHitbox = scrapHound->getArrowHitbox();
+            }
+            if (CheckCollisionRecs(weaponHitbox, enemyHitbox)) {
+                HitCandidate hit;
+                hit.source = HitSource::WEAPON;
+                hit.target = handle;
+                hit.sourceId = currentWeapon->getSwingId();
+                hit.damage = static_cast<int>(currentWeapon->getDamage());
+                hit.knockback = currentWeapon->getKnockback(facingRight);
+                hit.impact = {enemyHitbox.x + enemyHitbox.width/2, enemyHitbox.y + enemyHitbox.height/2};
+                hit.particleCount = 6;
+                hit.particleColor = RED;
+                if (enemy->getType() == EnemyType::AUTOMATON) {
+                    hit.particleColor = ORANGE;
+                } else if (enemy->getType() == EnemyType::DETONODE) {
+                    hit.particleColor = YELLOW;
                 }
+                CombatResolver::getInstance().submit(hit);
             }
-        }));
-    }
-    for (auto& f : enemyFutures) {
-        if (f.valid()) f.get();
+        }
     }
 }
 
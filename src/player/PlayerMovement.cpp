@@ -1,5 +1,6 @@
 #include "Player.hpp"
 #include "effects/ParticleSystem.hpp"
+#include "core/RngService.hpp"
 #include "core/InputManager.hpp"
 #include <raylib.h>
 #include "raymath.h"
@@ -154,7 +155,8 @@ void Player::handleMovementInput(float dt, Core::InputManager& inputManager) {
                 dustTimer -= dt;
                 if (dustTimer <= 0.0f) {
                     Vector2 dustPos = { position.x + hitboxOffsetX + hitboxWidth/2, position.y + hitboxOffsetY + hitboxHeight - 4 };
-                    Vector2 dustVel = { (float)GetRandomValue(-20, 20), (float)GetRandomValue(-60, -20) };
+                    FastRNG& rng = RngService::getInstance().local(RngStream::PARTICLES);
+                    Vector2 dustVel = { rng.nextFloat(-20.0f, 20.0f), rng.nextFloat(-60.0f, -20.0f) };
                     ParticleSystem::getInstance().createDustParticle(dustPos, dustVel, 0.25f);
                     dustTimer = 0.04f; 
                 }
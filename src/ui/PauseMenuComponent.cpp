@@ -27,53 +27,42 @@ namespace UI {
             bgData[i].hLineColors.resize(NUM_HORIZONTAL_LINES);
             bgData[i].vLineColors.resize(NUM_VERTICAL_LINES);
         }
-        
-        bgAnimThread = std::thread(&PauseMenuComponent::updateBackgroundAnimations, this);
     }
 
-    PauseMenuComponent::~PauseMenuComponent() {
-        threadRunning = false;
-        if (bgAnimThread.joinable()) {
-            bgAnimThread.join();
-        }
-    }
+    PauseMenuComponent::~PauseMenuComponent() = default;
 
-    void PauseMenuComponent::updateBackgroundAnimations() {
-        float localTitleAnimTime = 0.0f;
+    void PauseMenuComponent::updateBackgroundAnimations(float dt) {
+        bgAnimTime += dt;
+        float localTitleAnimTime = bgAnimTime;
         
-        while (threadRunning) {
-            localTitleAnimTime += 0.016f;
-            
-            int nextBuffer = 1 - currentBgBuffer;
-            auto& data = bgData[nextBuffer];
-            
-            for (int i = 0; i < NUM_HORIZONTAL_LINES; ++i) {
-                data.hLinePositions[i] = std::sin(localTitleAnimTime * 0.6f + i * 0.5f) * 40.0f + static_cast<float>(screenHeight) * (i + 1) / (NUM_HORIZONTAL_LINES + 1);
-                
-                float intensity = 0.4f + 0.3f * std::sin(localTitleAnimTime * 1.0f + i * 0.7f);
-                data.hLineColors[i] = {
-                    static_cast<unsigned char>(80 + intensity * 80),
-                    static_cast<unsigned char>(40 + intensity * 60),
-                    static_cast<unsigned char>(20 + intensity * 40),
-                    static_cast<unsigned char>(80 + intensity * 100)
-                };
-            }
+        int nextBuffer = 1 - currentBgBuffer;
+        auto& data = bgData[nextBuffer];
+        
+        for (int i = 0; i < NUM_HORIZONTAL_LINES; ++i) {
+            data.hLinePositions[i] = std::sin(localTitleAnimTime * 0.6f + i * 0.5f) * 40.0f + static_cast<float>(screenHeight) * (i + 1) / (NUM_HORIZONTAL_LINES + 1);
             
-            for (int i = 0; i < NUM_VERTICAL_LINES; ++i) {
-                data.vLinePositions[i] = std::cos(localTitleAnimTime * 0.7f + i * 0.6f) * 25.0f + static_cast<float>(screenWidth) * (i + 1) / static_cast<float>(NUM_VERTICAL_LINES + 1);
-                
-                float intensity = 0.3f + 0.4f * std::cos(localTitleAnimTime * 1.3f + i * 0.9f);
-                data.vLineColors[i] = {
-                    static_cast<unsigned char>(60 + intensity * 70),
-                    static_cast<unsigned char>(30 + intensity * 50),
-                    static_cast<unsigned char>(10 + intensity * 30),
-                    static_cast<unsigned char>(60 + intensity * 80)
-                };
-            }
+            float intensity = 0.4f + 0.3f * std::sin(localTitleAnimTime * 1.0f + i * 0.7f);
+            data.hLineColors[i] = {
+                static_cast<unsigned char>(80 + intensity * 80),
+                static_cast<unsigned char>(40 + intensity * 60),
+                static_cast<unsigned char>(20 + intensity * 40),
+                static_cast<unsigned char>(80 + intensity * 100)
+            };
+        }
+        
+        for (int i = 0; i < NUM_VERTICAL_LINES; ++i) {
+            data.vLinePositions[i] = std::cos(localTitleAnimTime * 0.7f + i * 0.6f) * 25.0f + static_cast<float>(screenWidth) * (i + 1) / static_cast<float>(NUM_VERTICAL_LINES + 1);
             
-            data.ready = true;
-            std::this_thread::sleep_for(std::chrono::milliseconds(16));
+            float intensity = 0.3f + 0.4f * std::cos(localTitleAnimTime * 1.3f + i * 0.9f);
+            data.vLineColors[i] = {
+                static_cast<unsigned char>(60 + intensity * 70),
+                static_cast<unsigned char>(30 + intensity * 50),
+                static_cast<unsigned char>(10 + intensity * 30),
+                static_cast<unsigned char>(60 + intensity * 80)
+            };
         }
+        
+        data.ready = true;
     }
 
     void PauseMenuComponent::update(float dt) {
@@ -82,6 +71,7 @@ namespace UI {
         inputCooldownTimer -= dt;
         
         handleInput();
+        updateBackgroundAnimations(dt);
         
         if (bgData[1 - currentBgBuffer].ready) {
             currentBgBuffer = 1 - currentBgBuffer;
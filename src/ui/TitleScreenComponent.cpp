@@ -27,53 +27,42 @@ namespace UI {
             bgData[i].hLineColors.resize(NUM_HORIZONTAL_LINES);
             bgData[i].vLineColors.resize(NUM_VERTICAL_LINES);
         }
-        
-        bgAnimThread = std::thread(&TitleScreenComponent::updateBackgroundAnimations, this);
     }
 
-    TitleScreenComponent::~TitleScreenComponent() {
-        threadRunning = false;
-        if (bgAnimThread.joinable()) {
-            bgAnimThread.join();
-        }
-    }
+    TitleScreenComponent::~TitleScreenComponent() = default;
 
-    void TitleScreenComponent::updateBackgroundAnimations() {
-        float localTitleAnimTime = 0.0f;
+    void TitleScreenComponent::updateBackgroundAnimations(float dt) {
+        bgAnimTime += dt;
+        float localTitleAnimTime = bgAnimTime;
         
-        while (threadRunning) {
-            localTitleAnimTime += 0.016f;
-            
-            int nextBuffer = 1 - currentBgBuffer;
-            auto& data = bgData[nextBuffer];
-            
-            for (int i = 0; i < NUM_HORIZONTAL_LINES; ++i) {
-                data.hLinePositions[i] = std::sin(localTitleAnimTime * 0.8f + i * 0.4f) * 50.0f + static_cast<float>(screenHeight) * (i + 1) / static_cast<float>(NUM_HORIZONTAL_LINES + 1);
-                
-                float intensity = 0.3f + 0.4f * std::sin(localTitleAnimTime * 1.2f + i * 0.6f);
-                data.hLineColors[i] = {
-                    static_cast<unsigned char>(50 + intensity * 100),
-                    static_cast<unsigned char>(150 + intensity * 105),
-                    static_cast<unsigned char>(200 + intensity * 55),
-                    static_cast<unsigned char>(60 + intensity * 120)
-                };
-            }
+        int nextBuffer = 1 - currentBgBuffer;
+        auto& data = bgData[nextBuffer];
+        
+        for (int i = 0; i < NUM_HORIZONTAL_LINES; ++i) {
+            data.hLinePositions[i] = std::sin(localTitleAnimTime * 0.8f + i * 0.4f) * 50.0f + static_cast<float>(screenHeight) * (i + 1) / static_cast<float>(NUM_HORIZONTAL_LINES + 1);
             
-            for (int i = 0; i < NUM_VERTICAL_LINES; ++i) {
-                data.vLinePositions[i] = std::cos(localTitleAnimTime * 0.6f + i * 0.5f) * 30.0f + static_cast<float>(screenWidth) * (i + 1) / static_cast<float>(NUM_VERTICAL_LINES + 1);
-                
-                float intensity = 0.2f + 0.3f * std::cos(localTitleAnimTime * 1.5f + i * 0.8f);
-                data.vLineColors[i] = {
-                    static_cast<unsigned char>(30 + intensity * 80),
-                    static_cast<unsigned char>(100 + intensity * 100),
-                    static_cast<unsigned char>(180 + intensity * 75),
-                    static_cast<unsigned char>(40 + intensity * 100)
-                };
-            }
+            float intensity = 0.3f + 0.4f * std::sin(localTitleAnimTime * 1.2f + i * 0.6f);
+            data.hLineColors[i] = {
+                static_cast<unsigned char>(50 + intensity * 100),
+                static_cast<unsigned char>(150 + intensity * 105),
+                static_cast<unsigned char>(200 + intensity * 55),
+                static_cast<unsigned char>(60 + intensity * 120)
+            };
+        }
+        
+        for (int i = 0; i < NUM_VERTICAL_LINES; ++i) {
+            data.vLinePositions[i] = std::cos(localTitleAnimTime * 0.6f + i * 0.5f) * 30.0f + static_cast<float>(screenWidth) * (i + 1) / static_cast<float>(NUM_VERTICAL_LINES + 1);
             
-            data.ready = true;
-            std::this_thread::sleep_for(std::chrono::milliseconds(16));
+            float intensity = 0.2f + 0.3f * std::cos(localTitleAnimTime * 1.5f + i * 0.8f);
+            data.vLineColors[i] = {
+                static_cast<unsigned char>(30 + intensity * 80),
+                static_cast<unsigned char>(100 + intensity * 100),
+                static_cast<unsigned char>(180 + intensity * 75),
+                static_cast<unsigned char>(40 + intensity * 100)
+            };
         }
+        
+        data.ready = true;
     }
 
     void TitleScreenComponent::update(float dt) {
@@ -85,6 +74,7 @@ namespace UI {
         }
         
         handleInput();
+        updateBackgroundAnimations(dt);
         
         if (bgData[1 - currentBgBuffer].ready) {
             currentBgBuffer = 1 - currentBgBuffer;
@@ -6,22 +6,15 @@
 #include "ui/LoadingScreenComponent.hpp"
 #include "Game.hpp"
 
-#include <chrono>
+#include <cmath>
 
 namespace UI {
     UIController::UIController(int width, int height) 
         : screenWidth(width), screenHeight(height), activeComponent(ComponentType::LOADING_SCREEN) {
         initializeComponents();
-        backgroundThread = std::thread(&UIController::handleBackgroundThread, this);
     }
 
-    UIController::~UIController() {
-        threadRunning = false;
-        dataCondition.notify_all();
-        if (backgroundThread.joinable()) {
-            backgroundThread.join();
-        }
-    }
+    UIController::~UIController() = default;
 
     void UIController::initializeComponents() {
         components[ComponentType::LOADING_SCREEN] = std::make_unique<LoadingScreenComponent>(screenWidth, screenHeight);
@@ -33,7 +26,6 @@ namespace UI {
 
     void UIController::update(float dt, GameState currentState, const Player* player) {
         globalAnimTime += dt;
-        needsUpdate = true;
         
         ComponentType targetComponent;
         switch (currentState) {
@@ -68,7 +60,7 @@ namespace UI {
         
         lastDeltaTime = dt; 
         
-        dataCondition.notify_one();
+        updateAnimations();
     }
 
     UIAction UIController::draw(GameState currentState, const Player* player, const Map* map) {
@@ -105,20 +97,6 @@ namespace UI {
         globalAnimTime = 0.0f;
     }
 
-    void UIController::handleBackgroundThread() {
-        while (threadRunning) {
-            std::unique_lock<std::mutex> lock(dataMutex);
-            dataCondition.wait(lock, [this] { return needsUpdate.load() || !threadRunning.load(); });
-            
-            if (!threadRunning) break;
-            
-            updateAnimations();
-            needsUpdate = false;
-            
-            std::this_thread::sleep_for(std::chrono::milliseconds(16));
-        }
-    }
-
     void UIController::updateAnimations() {
         int nextBuffer = 1 - currentBuffer;
         auto& data = drawData[nextBuffer];
@@ -142,7 +120,7 @@ namespace UI {
             });
         }
         
-        data.deltaTime = GetFrameTime();
+        data.deltaTime = lastDeltaTime;
         data.ready = true;
         
         currentBuffer = nextBuffer;
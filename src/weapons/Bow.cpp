@@ -3,6 +3,7 @@
 #include "enemies/EnemyManager.hpp"
 #include "effects/ParticleSystem.hpp"
 #include "map/Map.hpp"
+#include "ProjectileSystem.hpp"
 
 #include <cmath>
 #include <cfloat>
@@ -34,6 +35,8 @@ namespace {
     constexpr float MIN_ARROW_SPEED = 300.0f;
     constexpr float MAX_THEORETICAL_ARROW_SPEED = 700.0f;
     constexpr float EFFECTIVE_SPEED_CAP = 696.0f;
+    constexpr float ARROW_WIDTH = 16.0f;
+    constexpr float ARROW_HEIGHT = 8.0f;
 
     constexpr float ARROW_KNOCKBACK_BASE_X = 150.0f;
     constexpr float ARROW_KNOCKBACK_BASE_Y = 150.0f; 
@@ -59,18 +62,10 @@ namespace {
     constexpr float CHARGE_METER_BG_ALPHA = 0.5f;
     constexpr float CHARGE_METER_FG_ALPHA = 0.8f;
 
-    constexpr float ARROW_DRAW_Y_OFFSET = -4.0f;
-    constexpr float ARROW_DRAW_WIDTH = 32.0f;
-    constexpr float ARROW_DRAW_HEIGHT = 8.0f;
-    constexpr float ARROW_DRAW_LINE_THICKNESS = 1.0f;
-
     constexpr float BOW_HITBOX_X = 0.0f;
     constexpr float BOW_HITBOX_Y = 0.0f;
     constexpr float BOW_HITBOX_WIDTH = 0.0f;
     constexpr float BOW_HITBOX_HEIGHT = 0.0f;
-
-    constexpr float SUBSTEP_SPEED_THRESHOLD = 600.0f;
-    constexpr int SUBSTEP_MAX_COUNT = 4;
 }
 
 Bow::Bow()
@@ -134,7 +129,6 @@ void Bow::draw(Vector2 playerPosition, bool facingRight) const {
     };
     DrawRectangleRec(boxRect, SKYBLUE);
     DrawRectangleLinesEx(boxRect, BOW_DRAW_LINE_THICKNESS, DARKBLUE);
-    drawArrows();
     if (charging) {
         float meterWidth = CHARGE_METER_WIDTH;
         float meterHeight = CHARGE_METER_HEIGHT;
@@ -167,129 +161,16 @@ void Bow::fireArrow(Vector2 startPosition, Vector2 direction) {
     
     bool wasFullyCharged = (chargeRatio >= 1.0f);
     
-    Arrow arrow;
+    ProjectileSpawn arrow;
+    arrow.kind = ProjectileKind::ARROW;
+    arrow.faction = Faction::PLAYER;
     arrow.position = { startPosition.x, startPosition.y + ARROW_START_Y_OFFSET };
-    arrow.prevPosition = arrow.position;  
-    arrow.direction = direction;
-    arrow.speed = arrowSpeed; 
+    arrow.velocity = { direction.x * arrowSpeed, direction.y * arrowSpeed };
+    arrow.size = { ARROW_WIDTH, ARROW_HEIGHT };
     arrow.lifetime = ARROW_LIFETIME;
-    arrow.active = true;
-    arrow.wasFullyCharged = wasFullyCharged;
-    arrow.particleTimer = 0.0f;
-    activeArrows.push_back(arrow);
-}
-
-void Bow::updateArrows(float dt, const Map& map) { 
-    for (auto& arrow : activeArrows) {
-        if (!arrow.active) continue; 
-
-        arrow.prevPosition = arrow.position;  
-        arrow.position.x += arrow.direction.x * arrow.speed * dt;
-        arrow.position.y += arrow.direction.y * arrow.speed * dt;
-        arrow.lifetime -= dt;
-        
-        // Check for wall collisions
-        int tileX = (int)(arrow.position.x / 32);
-        int tileY = (int)(arrow.position.y / 32);
-        if (map.isSolidTile(tileX, tileY)) {
-            arrow.active = false;
-            continue;
-        }
-        
-        // Spawn particles continuously for all arrows
-        arrow.particleTimer += dt;
-        constexpr float PARTICLE_SPAWN_INTERVAL = 0.05f; // Spawn particles every 0.05 seconds
-        if (arrow.particleTimer >= PARTICLE_SPAWN_INTERVAL) {
-            Color particleColor = arrow.wasFullyCharged ? RED : YELLOW;
-            ParticleSystem::getInstance().createExplosionParticles(arrow.position, 3, particleColor);
-            arrow.particleTimer = 0.0f;
-        }
-        
-        if (arrow.lifetime <= 0.0f) {
-            arrow.active = false; 
-        }
-    }
-    
-    activeArrows.erase(
-        std::remove_if(activeArrows.begin(), activeArrows.end(),
-                       [](const Arrow& a) { return !a.active; }),
-        activeArrows.end());
-}
-
-void Bow::checkArrowCollisions(EnemyManager& enemyManager) {
-    for (auto& arrow : activeArrows) {
-        if (!arrow.active) continue;
-        
-        auto enemies = enemyManager.getAllEnemies();
-        for (auto* enemy : enemies) {
-            if (enemy->isAlive()) {
-                Rectangle hitbox = enemy->getHitbox();
-                if (enemy->getType() == EnemyType::SCRAP_HOUND) {
-                    ScrapHound* scrapHound = static_cast<ScrapHound*>(enemy);
-                    hitbox = scrapHound->getArrowHitbox();
-                }
-                
-                if (CheckCollisionRecs(arrow.getHitbox(), hitbox)) {
-                    enemy->takeDamage(BOW_DAMAGE);
-                    arrow.active = false;
-                    break;
-                }
-            }
-        }
-    }
-}
-
-void Bow::updateArrowsWithSubsteps(float dt, EnemyManager& enemyManager, int substeps, const Map& map) {
-    float substepDt = dt / substeps;
-    for (int s = 0; s < substeps; ++s) {
-        for (auto& arrow : activeArrows) {
-            if (!arrow.active) continue; 
-
-            arrow.prevPosition = arrow.position;  
-            arrow.position.x += arrow.direction.x * arrow.speed * substepDt;
-            arrow.position.y += arrow.direction.y * arrow.speed * substepDt;
-            arrow.lifetime -= substepDt;
-            
-            int tileX = (int)(arrow.position.x / 32);
-            int tileY = (int)(arrow.position.y / 32);
-            if (map.isSolidTile(tileX, tileY)) {
-                arrow.active = false;
-                continue;
-            }
-            
-            arrow.particleTimer += substepDt;
-            constexpr float PARTICLE_SPAWN_INTERVAL = 0.05f;
-            if (arrow.particleTimer >= PARTICLE_SPAWN_INTERVAL) {
-                Color particleColor = arrow.wasFullyCharged ? RED : YELLOW;
-                ParticleSystem::getInstance().createExplosionParticles(arrow.position, 3, particleColor);
-                arrow.particleTimer = 0.0f;
-            }
-            
-            if (arrow.lifetime <= 0.0f) {
-                arrow.active = false; 
-            }
-        }
-        checkArrowCollisions(enemyManager);
-    }
-    
-    activeArrows.erase(
-        std::remove_if(activeArrows.begin(), activeArrows.end(),
-                       [](const Arrow& a) { return !a.active; }),
-        activeArrows.end());
-}
-
-void Bow::drawArrows() const {
-    for (const auto& arrow : activeArrows) {
-        if (!arrow.active) continue;
-        Rectangle arrowRect = {
-            arrow.position.x,
-            arrow.position.y + ARROW_DRAW_Y_OFFSET,
-            ARROW_DRAW_WIDTH,
-            ARROW_DRAW_HEIGHT
-        };
-        DrawRectangleRec(arrowRect, GREEN);
-        DrawRectangleLinesEx(arrowRect, ARROW_DRAW_LINE_THICKNESS, DARKGREEN);
-    }
+    arrow.damage = static_cast<int>(BOW_DAMAGE);
+    arrow.trailColor = wasFullyCharged ? RED : YELLOW;
+    ProjectileSystem::getInstance().spawn(arrow);
 }
 
 bool Bow::isCharging() const {
@@ -303,12 +184,3 @@ bool Bow::isFullyCharged() const {
 void Bow::updatePosition(Vector2 newPosition) {
     position = newPosition;
 }
-
-bool Bow::hasActiveArrows() const {
-    return !activeArrows.empty();
-}
-
-Rectangle Bow::Arrow::getHitbox() const {
-    return { position.x, position.y, 16, 8 };
-}
-
@@ -98,6 +98,8 @@ Rectangle Sword::getHitbox(Vector2 playerPosition, bool facingRight) const {
 }
 
 void Sword::startAttack() {
+    // A press mid-swing restarts it as the next combo hit, a swing of its own.
+    if (this->attacking) beginSwing();
     Weapon::startAttack(); 
 
     this->attacking = true;
@@ -1,5 +1,7 @@
 #include "weapons/Weapon.hpp"
 
+uint32_t Weapon::nextSwingId = 1;
+
 Weapon::Weapon(const std::string& name, WeaponType type, float baseDamage, float attackSpeed, float range)
     : name(name), type(type), baseDamage(baseDamage), attackSpeed(attackSpeed), range(range) {
 }
@@ -26,6 +28,7 @@ void Weapon::draw(Vector2 playerPosition, bool facingRight) const {
 void Weapon::startAttack() {
     if (!attacking) {
         attacking = true;
+        beginSwing();
         attackTimer = 1.0f / attackSpeed;
         comboCount = (comboCount + 1) % 3;
     }
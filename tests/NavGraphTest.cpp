@@ -0,0 +1,108 @@
+#include "map/NavGraph.hpp"
+#include "map/Map.hpp"
+#include "core/FastRNG.hpp"
+#include "core/JobSystem.hpp"
+#include "core/RngService.hpp"
+#include <vector>
+
+#define TEST_NAME "NavGraphTest"
+#include "TestCheck.hpp"
+
+namespace {
+    Vector2 Tile(int x, int y) {
+        return { x * 32.0f, y * 32.0f };
+    }
+
+    // The repaired graph must answer like one built from scratch on the same
+    // tiles. Routes may differ on ties, so only reachability is compared.
+    bool SameReachability(const Map& map, Vector2 start, Vector2 goal) {
+        NavGraph fresh;
+        fresh.build(map);
+        std::vector<NavWaypoint> repairedPath;
+        std::vector<NavWaypoint> freshPath;
+        bool repaired = map.getNavGraph()->findPath(start, goal, repairedPath);
+        bool rebuilt = fresh.findPath(start, goal, freshPath);
+        return repaired == rebuilt && map.getNavGraph()->getSpanCount() == fresh.getSpanCount();
+    }
+
+    void ClearInterior(Map& map) {
+        for (int x = 1; x < map.getWidth() - 1; ++x) {
+            for (int y = 1; y < map.getHeight() - 1; ++y) {
+                map.setTileValue(x, y, MapConstants::EMPTY_TILE_VALUE);
+            }
+        }
+        map.repairNavGraph();
+    }
+
+    void TestLongLadderAfterLedgeRemoval() {
+        Map map(64, 64, {});
+        ClearInterior(map);
+
+        // Floor at row 33 (chunk row 2), a ladder up to row 16 and a ledge on
+        // row 15 (chunk row 0): the ladder top is two chunks from its foot.
+        for (int x = 4; x <= 12; ++x) map.setTileValue(x, 33, MapConstants::WALL_TILE_VALUE);
+        for (int y = 16; y <= 32; ++y) map.setTileValue(11, y, MapConstants::LADDER_TILE_VALUE);
+        for (int x = 4; x <= 10; ++x) map.setTileValue(x, 16, MapConstants::WALL_TILE_VALUE);
+        map.repairNavGraph();
+        CHECK(SameReachability(map, Tile(10, 32), Tile(5, 15)));
+
+        // Walling the ledge frees its span, and the new ledge on row 14 reuses
+        // the index. Only chunks next to row 0 are relinked.
+        for (int x = 4; x <= 10; ++x) map.setTileValue(x, 15, MapConstants::WALL_TILE_VALUE);
+        map.repairNavGraph();
+        CHECK(SameReachability(map, Tile(10, 32), Tile(5, 14)));
+        CHECK(SameReachability(map, Tile(10, 32), Tile(5, 15)));
+    }
+
+    void TestRandomEditsMatchRebuild() {
+        Map map(160, 96, {});
+        FastRNG rng(7);
+        const int values[] = {
+            MapConstants::EMPTY_TILE_VALUE,
+            MapConstants::WALL_TILE_VALUE,
+            MapConstants::PLATFORM_TILE_VALUE,
+            MapConstants::LADDER_TILE_VALUE,
+            MapConstants::ROPE_TILE_VALUE
+        };
+
+        for (int round = 0; round < 12; ++round) {
+            for (int edit = 0; edit < 40; ++edit) {
+                int x = 1 + static_cast<int>(rng.nextUInt(map.getWidth() - 2));
+                int y = 1 + static_cast<int>(rng.nextUInt(map.getHeight() - 2));
+                // Vertical strokes so ladders and drops cross chunk rows.
+                int length = 1 + static_cast<int>(rng.nextUInt(20));
+                int value = values[rng.nextUInt(5)];
+                for (int dy = 0; dy < length && y + dy < map.getHeight() - 1; ++dy) {
+                    map.setTileValue(x, y + dy, value);
+                }
+            }
+            map.repairNavGraph();
+
+            NavGraph fresh;
+            fresh.build(map);
+            CHECK(map.getNavGraph()->getSpanCount() == fresh.getSpanCount());
+
+            int mismatches = 0;
+            std::vector<NavWaypoint> repairedPath;
+            std::vector<NavWaypoint> freshPath;
+            for (int query = 0; query < 300; ++query) {
+                Vector2 start = Tile(1 + rng.nextUInt(map.getWidth() - 2), 1 + rng.nextUInt(map.getHeight() - 2));
+                Vector2 goal = Tile(1 + rng.nextUInt(map.getWidth() - 2), 1 + rng.nextUInt(map.getHeight() - 2));
+                bool repaired = map.getNavGraph()->findPath(start, goal, repairedPath);
+                bool rebuilt = fresh.findPath(start, goal, freshPath);
+                if (repaired != rebuilt) ++mismatches;
+            }
+            CHECK(mismatches == 0);
+        }
+    }
+}
+
+int main() {
+    RngService::getInstance().setRunSeed(42);
+
+    TestLongLadderAfterLedgeRemoval();
+    TestRandomEditsMatchRebuild();
+
+    JobSystem::getInstance().shutdown();
+    return TestCheck::Finish();
+}
@@ -0,0 +1,160 @@
+#include "effects/ParticleQuads.hpp"
+#include "effects/ParticleSystem.hpp"
+#include <vector>
+
+#define TEST_NAME "ParticleQuadsTest"
+#include "TestCheck.hpp"
+
+namespace {
+    void AddParticle(ParticleStreams& streams, float x, float y, float radius, Color color, float alpha,
+                     ParticlePriority priority = ParticlePriority::EFFECT) {
+        streams.px.push_back(x);
+        streams.py.push_back(y);
+        streams.vx.push_back(0.0f);
+        streams.vy.push_back(0.0f);
+        streams.life.push_back(1.0f);
+        streams.invMaxLife.push_back(1.0f);
+        streams.alpha.push_back(alpha);
+        streams.radius.push_back(radius);
+        streams.color.push_back(color);
+        streams.priority.push_back(priority);
+        ++streams.count;
+    }
+
+    struct Buffers {
+        std::vector<float> positions;
+        std::vector<unsigned char> colors;
+
+        explicit Buffers(size_t quads) : positions(quads * 18, -1.0f), colors(quads * 24, 0) {}
+    };
+
+    const Rectangle VIEW = { 0.0f, 0.0f, 100.0f, 100.0f };
+
+    void TestCulling() {
+        ParticleStreams streams;
+        AddParticle(streams, 50.0f, 50.0f, 2.0f, RED, 1.0f);      // inside
+        AddParticle(streams, -10.0f, 50.0f, 2.0f, GREEN, 1.0f);   // left of the view
+        AddParticle(streams, 50.0f, 120.0f, 2.0f, BLUE, 1.0f);    // below
+        AddParticle(streams, -1.0f, -1.0f, 2.0f, WHITE, 1.0f);    // straddles the corner
+        AddParticle(streams, 102.0f, 50.0f, 2.0f, YELLOW, 1.0f);  // touches the right edge
+
+        Buffers out(streams.size());
+        size_t quads = buildParticleQuads(streams, VIEW, ParticleLayer::IN_FRONT, out.positions.data(), out.colors.data(), streams.size());
+        CHECK(quads == 3);
+        // Kept particles are packed in stream order.
+        CHECK(out.colors[0] == RED.r && out.colors[1] == RED.g && out.colors[2] == RED.b);
+        CHECK(out.colors[24] == WHITE.r && out.colors[25] == WHITE.g);
+        CHECK(out.colors[48] == YELLOW.r && out.colors[49] == YELLOW.g && out.colors[50] == YELLOW.b);
+    }
+
+    void TestCornersAndWinding() {
+        ParticleStreams streams;
+        AddParticle(streams, 10.0f, 20.0f, 3.0f, RED, 1.0f);
+
+        Buffers out(1);
+        CHECK(buildParticleQuads(streams, VIEW, ParticleLayer::IN_FRONT, out.positions.data(), out.colors.data(), 1) == 1);
+
+        // TL, BL, BR / TL, BR, TR.
+        const float expected[6][2] = {
+            { 7.0f, 17.0f }, { 7.0f, 23.0f }, { 13.0f, 23.0f },
+            { 7.0f, 17.0f }, { 13.0f, 23.0f }, { 13.0f, 17.0f }
+        };
+        for (int v = 0; v < 6; ++v) {
+            CHECK(out.positions[v * 3 + 0] == expected[v][0]);
+            CHECK(out.positions[v * 3 + 1] == expected[v][1]);
+            CHECK(out.positions[v * 3 + 2] == 0.0f);
+        }
+
+        // Both triangles wind the same way (y grows downwards).
+        for (int tri = 0; tri < 2; ++tri) {
+            const float* a = &out.positions[tri * 9];
+            const float* b = a + 3;
+            const float* c = a + 6;
+            float cross = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+            CHECK(cross < 0.0f);
+        }
+    }
+
+    void TestColorAndAlpha() {
+        ParticleStreams streams;
+        Color color = { 10, 20, 30, 77 };
+        AddParticle(streams, 50.0f, 50.0f, 1.0f, color, 0.5f);
+        AddParticle(streams, 50.0f, 50.0f, 1.0f, color, 1.5f);
+        AddParticle(streams, 50.0f, 50.0f, 1.0f, color, -0.5f);
+
+        Buffers out(3);
+        CHECK(buildParticleQuads(streams, VIEW, ParticleLayer::IN_FRONT, out.positions.data(), out.colors.data(), 3) == 3);
+
+        // The base colour's own alpha is ignored; the alpha stream is clamped to 0..1.
+        const unsigned char expectedAlpha[3] = { 127, 255, 0 };
+        for (int q = 0; q < 3; ++q) {
+            for (int v = 0; v < 6; ++v) {
+                const unsigned char* c = &out.colors[q * 24 + v * 4];
+                CHECK(c[0] == 10 && c[1] == 20 && c[2] == 30);
+                CHECK(c[3] == expectedAlpha[q]);
+            }
+        }
+    }
+
+    void TestMaxQuadsClamp() {
+        ParticleStreams streams;
+        for (int i = 0; i < 5; ++i) {
+            AddParticle(streams, 10.0f + i, 10.0f, 1.0f, RED, 1.0f);
+        }
+
+        Buffers out(5);
+        CHECK(buildParticleQuads(streams, VIEW, ParticleLayer::IN_FRONT, out.positions.data(), out.colors.data(), 2) == 2);
+        // Nothing past the second quad is touched.
+        CHECK(out.positions[2 * 18] == -1.0f);
+        CHECK(out.colors[2 * 24] == 0);
+
+        CHECK(buildParticleQuads(streams, VIEW, ParticleLayer::IN_FRONT, out.positions.data(), out.colors.data(), 0) == 0);
+    }
+
+    void TestLayers() {
+        ParticleStreams streams;
+        AddParticle(streams, 10.0f, 10.0f, 1.0f, RED, 1.0f, ParticlePriority::AMBIENT);
+        AddParticle(streams, 20.0f, 10.0f, 1.0f, GREEN, 1.0f, ParticlePriority::EFFECT);
+        AddParticle(streams, 30.0f, 10.0f, 1.0f, BLUE, 1.0f, ParticlePriority::GAMEPLAY);
+        AddParticle(streams, 40.0f, 10.0f, 1.0f, WHITE, 1.0f, ParticlePriority::AMBIENT);
+
+        // Each particle is drawn by exactly one layer.
+        Buffers behind(4);
+        CHECK(buildParticleQuads(streams, VIEW, ParticleLayer::BEHIND_ACTORS, behind.positions.data(), behind.colors.data(), 4) == 2);
+        CHECK(behind.colors[0] == RED.r && behind.colors[1] == RED.g);
+        CHECK(behind.colors[24] == WHITE.r && behind.colors[25] == WHITE.g);
+
+        Buffers front(4);
+        CHECK(buildParticleQuads(streams, VIEW, ParticleLayer::IN_FRONT, front.positions.data(), front.colors.data(), 4) == 2);
+        CHECK(front.colors[0] == GREEN.r && front.colors[1] == GREEN.g);
+        CHECK(front.colors[24] == BLUE.r && front.colors[25] == BLUE.g && front.colors[26] == BLUE.b);
+    }
+
+    void TestTexcoords() {
+        const size_t quads = 3;
+        std::vector<float> texcoords(quads * 12, -1.0f);
+        fillParticleQuadTexcoords(texcoords.data(), quads);
+
+        // Matches the corner order of the positions.
+        const float expected[12] = {
+            0.0f, 0.0f,  0.0f, 1.0f,  1.0f, 1.0f,
+            0.0f, 0.0f,  1.0f, 1.0f,  1.0f, 0.0f
+        };
+        for (size_t q = 0; q < quads; ++q) {
+            for (int i = 0; i < 12; ++i) {
+                CHECK(texcoords[q * 12 + i] == expected[i]);
+            }
+        }
+    }
+}
+
+int main() {
+    TestCulling();
+    TestCornersAndWinding();
+    TestColorAndAlpha();
+    TestMaxQuadsClamp();
+    TestLayers();
+    TestTexcoords();
+
+    return TestCheck::Finish();
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdio>
+
+// The check harness shared by the test executables. Define TEST_NAME before
+// including it; every message is prefixed with it. CHECK records a failure
+// and carries on, and main returns TestCheck::Finish().
+#ifndef TEST_NAME
+#error "Define TEST_NAME before including TestCheck.hpp"
+#endif
+
+namespace TestCheck {
+    inline int failures = 0;
+
+    inline void Check(bool condition, const char* what, int line) {
+        if (!condition) {
+            printf("[" TEST_NAME "] FAILED line %d: %s\n", line, what);
+            ++failures;
+        }
+    }
+
+    inline int Finish() {
+        if (failures > 0) {
+            printf("[" TEST_NAME "] %d check(s) failed\n", failures);
+            return 1;
+        }
+        printf("[" TEST_NAME "] All checks passed\n");
+        return 0;
+    }
+}
+
+#define CHECK(condition) TestCheck::Check((condition), #condition, __LINE__)